@@ -345,6 +345,28 @@ enum DcoNodeBranchDir {
   DcoNodeBranchDirectionUp
 };
 
+/** Child to plunge into after branching a node. */
+enum DcoPlungeChild {
+  DcoPlungeChildNone = 0,
+  DcoPlungeChildDown,
+  DcoPlungeChildUp,
+  DcoPlungeChildRound
+};
+
+/** Phases of processing a node, timed by DcoNodeTimer. */
+enum DcoNodePhase {
+  DcoNodePhaseInstall = 0,
+  DcoNodePhaseBound,
+  DcoNodePhaseFeasibility,
+  DcoNodePhaseGenerateCons,
+  DcoNodePhaseApplyCons,
+  DcoNodePhaseCheckCuts,
+  DcoNodePhaseHeuristics,
+  DcoNodePhaseBranchCands,
+  DcoNodePhaseBranch,
+  DcoNodePhaseNum
+};
+
 /** Integral type */
 enum DcoIntegralityType {
   DcoIntegralityTypeCont = 0,
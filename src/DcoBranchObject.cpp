@@ -21,6 +21,10 @@ DcoBranchObject::DcoBranchObject(int index, double score, double value)
   : BcpsBranchObject(DcoBranchingObjectTypeInt, index, score, value) {
   ubDownBranch_ = floor(value);
   lbUpBranch_ = ceil(value);
+  downQuality_ = -ALPS_OBJ_MAX;
+  upQuality_ = -ALPS_OBJ_MAX;
+  downBasis_ = NULL;
+  upBasis_ = NULL;
 }
 
 /// Copy constructor.
@@ -28,6 +32,9 @@ DcoBranchObject::DcoBranchObject(DcoBranchObject const & other)
   : BcpsBranchObject(other) {
   ubDownBranch_ = other.ubDownBranch();
   lbUpBranch_ = other.lbUpBranch();
+  downBasis_ = NULL;
+  upBasis_ = NULL;
+  copyOutcome(other);
 }
 
 /// Helpful Copy constructor.
@@ -46,6 +53,9 @@ DcoBranchObject::DcoBranchObject(BcpsBranchObject const * other)
   }
   ubDownBranch_ = dco_other->ubDownBranch();
   lbUpBranch_ = dco_other->lbUpBranch();
+  downBasis_ = NULL;
+  upBasis_ = NULL;
+  copyOutcome(*dco_other);
 }
 
 /// Copy assignment operator
@@ -53,10 +63,52 @@ DcoBranchObject & DcoBranchObject::operator=(DcoBranchObject const & rhs) {
   BcpsBranchObject::operator=(rhs);
   ubDownBranch_ = rhs.ubDownBranch();
   lbUpBranch_ = rhs.lbUpBranch();
+  if (this!=&rhs) {
+    copyOutcome(rhs);
+  }
   return *this;
 }
 
 DcoBranchObject::~DcoBranchObject() {
+  delete downBasis_;
+  delete upBasis_;
+}
+
+void DcoBranchObject::copyOutcome(DcoBranchObject const & other) {
+  delete downBasis_;
+  delete upBasis_;
+  downQuality_ = other.downQuality();
+  upQuality_ = other.upQuality();
+  downBasis_ = NULL;
+  upBasis_ = NULL;
+  if (other.downBasis()) {
+    downBasis_ = new CoinWarmStartBasis(*other.downBasis());
+  }
+  if (other.upBasis()) {
+    upBasis_ = new CoinWarmStartBasis(*other.upBasis());
+  }
+  fixIndex_ = other.fixIndex();
+  fixLb_ = other.fixLb();
+  fixUb_ = other.fixUb();
+}
+
+void DcoBranchObject::setChildren(double downQuality, double upQuality,
+                                  CoinWarmStartBasis * downBasis,
+                                  CoinWarmStartBasis * upBasis) {
+  downQuality_ = downQuality;
+  upQuality_ = upQuality;
+  delete downBasis_;
+  delete upBasis_;
+  downBasis_ = downBasis;
+  upBasis_ = upBasis;
+}
+
+void DcoBranchObject::setFixings(std::vector<int> const & index,
+                                 std::vector<double> const & lb,
+                                 std::vector<double> const & ub) {
+  fixIndex_ = index;
+  fixLb_ = lb;
+  fixUb_ = ub;
 }
 
 // BcpsBranchObject * DcoBranchObject::clone() const {
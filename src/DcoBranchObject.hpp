@@ -19,8 +19,11 @@
 #define DcoBranchObject_hpp_
 
 #include <BcpsBranchObject.h>
+#include <CoinWarmStartBasis.hpp>
 #include "DcoModel.hpp"
 
+#include <vector>
+
 /*!
   Represents a DisCO branch object. DcoBranchObject inherits BcpsBranchObject.
 
@@ -31,6 +34,10 @@
 
   Has two fields, ubDownBranch_ and lbUpBranch_.
 
+  Strong branching records its outcome in the branch object, quality and
+  basis of the children and the bounds it tightened. These are used when
+  the children are created and they are not encoded.
+
  */
 
 class DcoBranchObject: virtual public BcpsBranchObject {
@@ -38,6 +45,26 @@ class DcoBranchObject: virtual public BcpsBranchObject {
   double ubDownBranch_;
   /// lower bound of the up branch
   double lbUpBranch_;
+  ///@name Strong branching outcome
+  //@{
+  /// Quality of the down child, ALPS_OBJ_MAX if it is infeasible and
+  /// -ALPS_OBJ_MAX if it is not known.
+  double downQuality_;
+  /// Quality of the up child.
+  double upQuality_;
+  /// Basis of the down child, NULL if it is not known.
+  CoinWarmStartBasis * downBasis_;
+  /// Basis of the up child.
+  CoinWarmStartBasis * upBasis_;
+  /// Columns whose bounds are tightened, the bounds hold in both children.
+  std::vector<int> fixIndex_;
+  /// Tightened lower bounds.
+  std::vector<double> fixLb_;
+  /// Tightened upper bounds.
+  std::vector<double> fixUb_;
+  //@}
+  /// Copy strong branching outcome of other.
+  void copyOutcome(DcoBranchObject const & other);
 public:
   ///@name Constructor and Destructors.
   //@{
@@ -76,6 +103,32 @@ public:
   double lbUpBranch() const { return lbUpBranch_; }
   //@}
 
+  ///@name Strong branching outcome
+  //@{
+  /// Set quality and basis of the children, takes ownership of the bases.
+  void setChildren(double downQuality, double upQuality,
+                   CoinWarmStartBasis * downBasis,
+                   CoinWarmStartBasis * upBasis);
+  /// Set bounds tightened at the node.
+  void setFixings(std::vector<int> const & index,
+                  std::vector<double> const & lb,
+                  std::vector<double> const & ub);
+  /// Get quality of the down child.
+  double downQuality() const { return downQuality_; }
+  /// Get quality of the up child.
+  double upQuality() const { return upQuality_; }
+  /// Get basis of the down child.
+  CoinWarmStartBasis const * downBasis() const { return downBasis_; }
+  /// Get basis of the up child.
+  CoinWarmStartBasis const * upBasis() const { return upBasis_; }
+  /// Get columns whose bounds are tightened.
+  std::vector<int> const & fixIndex() const { return fixIndex_; }
+  /// Get tightened lower bounds.
+  std::vector<double> const & fixLb() const { return fixLb_; }
+  /// Get tightened upper bounds.
+  std::vector<double> const & fixUb() const { return fixUb_; }
+  //@}
+
   ///@name Encode and Decode functions
   ///@{
   using AlpsKnowledge::encode;
@@ -30,27 +30,25 @@ int DcoBranchStrategyMaxInf::createCandBranchObjects(BcpsTreeNode * node) {
   DcoTreeNode * dco_node = dynamic_cast<DcoTreeNode*>(node);
   // get model
   DcoModel * dco_model = dynamic_cast<DcoModel*>(model());
-  // get number of relaxed columns
-  // we assume all relaxed columns are integer variables.
-  int num_relaxed = dco_model->numRelaxedCols();
   // get indices of relaxed object
   int const * relaxed = dco_model->relaxedCols();
   // store branch objects in bobjects
   std::vector<BcpsBranchObject*> bobjects;
-  // iterate over relaxed columns and populate bobjects
-  for (int i=0; i<num_relaxed; ++i) {
-    int preferredDir;
+  // integrality of relaxed columns, computed once for the solution.
+  dco_model->checkIntegrality();
+  int num_inf = dco_model->numInfRelaxed();
+  int const * inf_relaxed = dco_model->infRelaxed();
+  double const * infeas = dco_model->relaxedInfeas();
+  int const * dir = dco_model->relaxedDir();
+  // iterate over infeasible relaxed columns and populate bobjects
+  for (int k=0; k<num_inf; ++k) {
+    int i = inf_relaxed[k];
     BcpsObject * curr_object = dco_model->getVariables()[relaxed[i]];
-    double infeasibility = curr_object->infeasibility(dco_model, preferredDir);
-    // check the amount of infeasibility
-    if (infeasibility != 0.0) {
-      // create a branch object for this
-      BcpsBranchObject * cb =
-        curr_object->createBranchObject(dco_model, preferredDir);
-      // set score
-      cb->setScore(infeasibility);
-      bobjects.push_back(cb);
-    }
+    // create a branch object for this
+    BcpsBranchObject * cb = curr_object->createBranchObject(dco_model, dir[i]);
+    // set score
+    cb->setScore(infeas[i]);
+    bobjects.push_back(cb);
   }
   // add branch objects to branchObjects_
   setBranchObjects(bobjects);
@@ -21,18 +21,38 @@
 #include "DcoTreeNode.hpp"
 #include "DcoBranchObject.hpp"
 
+#include <AlpsEncoded.h>
+
 DcoBranchStrategyPseudo::DcoBranchStrategyPseudo(DcoModel * model):
   BcpsBranchStrategy(model) {
   setType(DcoBranchingStrategyPseudoCost);
-  // todo(aykut) think about parametrizing this.
-  score_factor_ = 1.0/6.0;
+  score_factor_ = 1.0 - model->dcoPar()->entry(DcoParams::pseudoWeight);
+  product_score_ = model->dcoPar()->entry(DcoParams::pseudoProductScore);
+  inf_penalty_ = model->dcoPar()->entry(DcoParams::pseudoInfPenalty);
+  cone_weight_ = model->dcoPar()->entry(DcoParams::coneBranchWeight);
   int num_relaxed = model->numRelaxedCols();
+  cone_factor_.assign(num_relaxed, 1.0);
   down_num_ = new int[num_relaxed]();
   up_num_ = new int[num_relaxed]();
   down_derivative_ = new double[num_relaxed]();
   up_derivative_ = new double[num_relaxed]();
+  down_sum_ = 0.0;
+  up_sum_ = 0.0;
+  down_total_ = 0;
+  up_total_ = 0;
+  down_shared_num_ = new int[num_relaxed]();
+  up_shared_num_ = new int[num_relaxed]();
+  down_shared_sum_ = new double[num_relaxed]();
+  up_shared_sum_ = new double[num_relaxed]();
+  share_depth_ = model->dcoPar()->entry(DcoParams::sharePcostDepth);
+  record_shared_ = false;
   // fill reverse map
   int const * relaxed_cols = model->relaxedCols();
+  int max_col = -1;
+  for (int i=0; i<num_relaxed; ++i) {
+    max_col = CoinMax(max_col, relaxed_cols[i]);
+  }
+  rev_relaxed_.assign(max_col+1, -1);
   for (int i=0; i<num_relaxed; ++i) {
     rev_relaxed_[relaxed_cols[i]] = i;
   }
@@ -55,6 +75,22 @@ DcoBranchStrategyPseudo::~DcoBranchStrategyPseudo() {
     delete[] up_derivative_;
     up_derivative_ = NULL;
   }
+  if (down_shared_num_) {
+    delete[] down_shared_num_;
+    down_shared_num_ = NULL;
+  }
+  if (up_shared_num_) {
+    delete[] up_shared_num_;
+    up_shared_num_ = NULL;
+  }
+  if (down_shared_sum_) {
+    delete[] down_shared_sum_;
+    down_shared_sum_ = NULL;
+  }
+  if (up_shared_sum_) {
+    delete[] up_shared_sum_;
+    up_shared_sum_ = NULL;
+  }
 }
 
 int DcoBranchStrategyPseudo::createCandBranchObjects(BcpsTreeNode * node) {
@@ -66,38 +102,37 @@ int DcoBranchStrategyPseudo::createCandBranchObjects(BcpsTreeNode * node) {
   DcoModel * dco_model = dynamic_cast<DcoModel*>(model());
   CoinMessageHandler * message_handler = dco_model->dcoMessageHandler_;
   CoinMessages * messages = dco_model->dcoMessages_;
-  // get number of relaxed columns
-  // we assume all relaxed columns are integer variables.
-  int num_relaxed = dco_model->numRelaxedCols();
   // get indices of relaxed object
   int const * relaxed = dco_model->relaxedCols();
   // store branch objects in bobjects
   std::vector<BcpsBranchObject*> bobjects;
-  // iterate over relaxed columns and populate bobjects
-  for (int i=0; i<num_relaxed; ++i) {
-    int preferredDir;
+  // integrality of relaxed columns, computed once for the solution.
+  dco_model->checkIntegrality();
+  int num_inf = dco_model->numInfRelaxed();
+  int const * inf_relaxed = dco_model->infRelaxed();
+  int const * dir = dco_model->relaxedDir();
+  double const * sol = dco_model->solver()->getColSolution();
+  setConeFactors();
+  // iterate over infeasible relaxed columns and populate bobjects
+  for (int k=0; k<num_inf; ++k) {
+    int i = inf_relaxed[k];
+    int preferredDir = dir[i];
     BcpsObject * curr_object = dco_model->getVariables()[relaxed[i]];
-    double infeasibility = curr_object->infeasibility(dco_model, preferredDir);
-    // check the amount of infeasibility
-    if (infeasibility != 0.0) {
-      double min = std::min(down_derivative_[i], up_derivative_[i]);
-      double max = std::max(down_derivative_[i], up_derivative_[i]);
-      // compute score
-      double score = score_factor_*max + (1.0-score_factor_)*min;
-      // create a branch object for this
-      BcpsBranchObject * cb =
-        curr_object->createBranchObject(dco_model, preferredDir);
-      // set score
-      cb->setScore(score);
-      bobjects.push_back(cb);
-
-      // debug stuff
-      message_handler->message(DISCO_PSEUDO_REPORT, *messages)
-        << dco_model->broker()->getProcRank()
-        << relaxed[i]
-        << score
-        << CoinMessageEol;
-    }
+    // compute score
+    double score = pseudoScore(i, sol[relaxed[i]]);
+    // create a branch object for this
+    BcpsBranchObject * cb =
+      curr_object->createBranchObject(dco_model, preferredDir);
+    // set score
+    cb->setScore(score);
+    bobjects.push_back(cb);
+
+    // debug stuff
+    message_handler->message(DISCO_PSEUDO_REPORT, *messages)
+      << dco_model->broker()->getProcRank()
+      << relaxed[i]
+      << score
+      << CoinMessageEol;
   }
   // add branch objects to branchObjects_
   setBranchObjects(bobjects);
@@ -126,7 +161,148 @@ DcoBranchStrategyPseudo::betterBranchObject(BcpsBranchObject const * current,
   return res;
 }
 
+void DcoBranchStrategyPseudo::mergePseudocost(int i, int dir, int num,
+                                              double sum) {
+  if (num<=0) {
+    return;
+  }
+  if (dir==DcoNodeBranchDirectionDown) {
+    int n = down_num_[i];
+    down_derivative_[i] = (down_derivative_[i]*n + sum)/(n+num);
+    down_num_[i] += num;
+    down_sum_ += sum;
+    down_total_ += num;
+  }
+  else {
+    int n = up_num_[i];
+    up_derivative_[i] = (up_derivative_[i]*n + sum)/(n+num);
+    up_num_[i] += num;
+    up_sum_ += sum;
+    up_total_ += num;
+  }
+}
+
+void DcoBranchStrategyPseudo::packShared(AlpsEncoded * encoded) {
+  int const * relaxed = dynamic_cast<DcoModel*>(model())->relaxedCols();
+  int size = static_cast<int>(shared_cols_.size());
+  encoded->writeRep(size);
+  for (int k=0; k<size; ++k) {
+    int i = shared_cols_[k];
+    // pack column index, relaxed indices are the same in all processes but
+    // columns are easier to check.
+    encoded->writeRep(relaxed[i]);
+    encoded->writeRep(down_shared_num_[i]);
+    encoded->writeRep(down_shared_sum_[i]);
+    encoded->writeRep(up_shared_num_[i]);
+    encoded->writeRep(up_shared_sum_[i]);
+    down_shared_num_[i] = 0;
+    down_shared_sum_[i] = 0.0;
+    up_shared_num_[i] = 0;
+    up_shared_sum_[i] = 0.0;
+  }
+  shared_cols_.clear();
+}
+
+void DcoBranchStrategyPseudo::unpackShared(AlpsEncoded & encoded) {
+  int size = 0;
+  encoded.readRep(size);
+  for (int k=0; k<size; ++k) {
+    int col;
+    int down_num;
+    double down_sum;
+    int up_num;
+    double up_sum;
+    encoded.readRep(col);
+    encoded.readRep(down_num);
+    encoded.readRep(down_sum);
+    encoded.readRep(up_num);
+    encoded.readRep(up_sum);
+    if (col<0 or col>=static_cast<int>(rev_relaxed_.size()) or
+        rev_relaxed_[col]<0) {
+      continue;
+    }
+    // received observations are merged but not shared again.
+    mergePseudocost(rev_relaxed_[col], DcoNodeBranchDirectionDown,
+                    down_num, down_sum);
+    mergePseudocost(rev_relaxed_[col], DcoNodeBranchDirectionUp,
+                    up_num, up_sum);
+  }
+}
+
+double DcoBranchStrategyPseudo::computeScore(double down, double up) const {
+  if (product_score_) {
+    // keep the score positive when an estimate is zero.
+    double const eps = 1e-6;
+    return CoinMax(down, eps)*CoinMax(up, eps);
+  }
+  double min = std::min(down, up);
+  double max = std::max(down, up);
+  return score_factor_*max + (1.0-score_factor_)*min;
+}
+
+double DcoBranchStrategyPseudo::averagePseudocost(int dir) const {
+  if (dir==DcoNodeBranchDirectionDown) {
+    return down_total_ ? down_sum_/down_total_ : 1.0;
+  }
+  return up_total_ ? up_sum_/up_total_ : 1.0;
+}
+
+double DcoBranchStrategyPseudo::pseudocost(int i, int dir) const {
+  if (dir==DcoNodeBranchDirectionDown) {
+    return down_num_[i] ? down_derivative_[i] : averagePseudocost(dir);
+  }
+  return up_num_[i] ? up_derivative_[i] : averagePseudocost(dir);
+}
+
+double DcoBranchStrategyPseudo::pseudoScore(int i, double value) const {
+  double down = pseudocost(i, DcoNodeBranchDirectionDown)*
+    (value-floor(value));
+  double up = pseudocost(i, DcoNodeBranchDirectionUp)*(ceil(value)-value);
+  return computeScore(down, up)*cone_factor_[i];
+}
+
+void DcoBranchStrategyPseudo::setConeFactors() {
+  if (cone_weight_<=0.0) {
+    return;
+  }
+  DcoModel * dco_model = dynamic_cast<DcoModel*>(model());
+  int const * relaxed = dco_model->relaxedCols();
+  dco_model->checkIntegrality();
+  dco_model->checkConeFeasibility();
+  int num_inf = dco_model->numInfRelaxed();
+  int const * inf_relaxed = dco_model->infRelaxed();
+  double max_infeas = dco_model->maxConeInfeas();
+  for (int k=0; k<num_inf; ++k) {
+    int i = inf_relaxed[k];
+    cone_factor_[i] = 1.0;
+    if (max_infeas>0.0) {
+      cone_factor_[i] += cone_weight_*
+        dco_model->coneParticipation(relaxed[i])/max_infeas;
+    }
+  }
+}
+
+void DcoBranchStrategyPseudo::infeasibleChild(DcoTreeNode * node) {
+  record_shared_ = node->getDepth()<=share_depth_;
+  // return if this is the root node
+  if (node->getParent()==NULL) {
+    return;
+  }
+  int branched_ind = node->getDesc()->getBranchedInd();
+  if (branched_ind<0 or
+      branched_ind>=static_cast<int>(rev_relaxed_.size()) or
+      rev_relaxed_[branched_ind]<0) {
+    return;
+  }
+  int dir = node->getDesc()->getBranchedDir();
+  updatePseudocost(rev_relaxed_[branched_ind], dir,
+                   inf_penalty_*averagePseudocost(dir));
+}
+
 void DcoBranchStrategyPseudo::update_statistics(DcoTreeNode * node) {
+  // observations of this node, including strong branching, are shared if
+  // it is shallow enough.
+  record_shared_ = node->getDepth()<=share_depth_;
   // return if this is the root node
   if (node->getParent()==NULL) {
     return;
@@ -142,48 +318,67 @@ void DcoBranchStrategyPseudo::update_statistics(DcoTreeNode * node) {
   // is this node a down or up branch
   int dir = node->getDesc()->getBranchedDir();
   // index of the branched variable for the current node
-  int branched_index = rev_relaxed_[node->getDesc()->getBranchedInd()];
+  int branched_ind = node->getDesc()->getBranchedInd();
+  if (branched_ind<0 or
+      branched_ind>=static_cast<int>(rev_relaxed_.size()) or
+      rev_relaxed_[branched_ind]<0) {
+    return;
+  }
+  int branched_index = rev_relaxed_[branched_ind];
   double branched_value = node->getDesc()->getBranchedVal();
 
   // update statistics
   double frac;
   if (dir==DcoNodeBranchDirectionDown) {
     frac = branched_value-floor(branched_value);
-    double deriv = (quality-parent_quality) / frac;
-    int n = down_num_[branched_index];
-    double old = down_derivative_[branched_index];
-    down_derivative_[branched_index] = (old*n + deriv)/(n+1);
-    down_num_[branched_index]++;
-
-    // debug stuff
-    message_handler->message(DISCO_PSEUDO_DUP, *messages)
-      << dco_model->broker()->getProcRank()
-      << node->getDesc()->getBranchedInd()
-      << old
-      << down_derivative_[branched_index]
-      << frac
-      << CoinMessageEol;
   }
   else if (dir==DcoNodeBranchDirectionUp) {
     frac = ceil(branched_value)-branched_value;
-    double deriv = (quality-parent_quality) / frac;
-    int n = up_num_[branched_index];
-    double old = up_derivative_[branched_index];
-    up_derivative_[branched_index] = (old*n + deriv)/(n+1);
-    up_num_[branched_index]++;
-
-    // debug stuff
-    message_handler->message(DISCO_PSEUDO_UUP, *messages)
-      << dco_model->broker()->getProcRank()
-      << node->getDesc()->getBranchedInd()
-      << old
-      << up_derivative_[branched_index]
-      << frac
-      << CoinMessageEol;
   }
   else {
     message_handler->message(9998, "Dco", "Invalid branching direction. ",
                              'E', 0)
       << CoinMessageEol;
+    return;
+  }
+  updatePseudocost(branched_index, dir, (quality-parent_quality) / frac);
+}
+
+void DcoBranchStrategyPseudo::updatePseudocost(int i, int dir,
+                                               double deriv) {
+  // get dco model and message stuff
+  DcoModel * dco_model = dynamic_cast<DcoModel*>(model());
+  CoinMessageHandler * message_handler = dco_model->dcoMessageHandler_;
+  CoinMessages * messages = dco_model->dcoMessages_;
+  double * derivative = up_derivative_;
+  int msg = DISCO_PSEUDO_UUP;
+  if (dir==DcoNodeBranchDirectionDown) {
+    derivative = down_derivative_;
+    msg = DISCO_PSEUDO_DUP;
   }
+  double old = derivative[i];
+  mergePseudocost(i, dir, 1, deriv);
+  // keep the observation to share with other processes
+  if (record_shared_) {
+    if (down_shared_num_[i]==0 and up_shared_num_[i]==0) {
+      shared_cols_.push_back(i);
+    }
+    if (dir==DcoNodeBranchDirectionDown) {
+      down_shared_num_[i]++;
+      down_shared_sum_[i] += deriv;
+    }
+    else {
+      up_shared_num_[i]++;
+      up_shared_sum_[i] += deriv;
+    }
+  }
+
+  // debug stuff
+  message_handler->message(msg, *messages)
+    << dco_model->broker()->getProcRank()
+    << dco_model->relaxedCols()[i]
+    << old
+    << derivative[i]
+    << deriv
+    << CoinMessageEol;
 }
@@ -20,10 +20,11 @@
 
 #include <BcpsBranchStrategy.h>
 
-#include <map>
+#include <vector>
 
 class DcoModel;
 class DcoTreeNode;
+class AlpsEncoded;
 /*!  This class implements pseudocost branching strategy. In this part we use
   the notation in Achterberg's PhD dissertation.
 
@@ -39,17 +40,36 @@ class DcoTreeNode;
   Let \f$ \varphi _j ^- \f$ be the average of \f$ \frac{\Delta _j ^-}{f_j ^-}
   \f$ considering all the times we branched on \f$ x_j \f$.
 
-  Then we compute score for variable \f$ x_j \f$ as follows,
+  Then we compute score for variable \f$ x_j \f$ from the estimated changes
+  \f$ \varphi _j ^- f_j ^- \f$ and \f$ \varphi _j ^+ f_j ^+ \f$ as follows,
 
-  \f[ score(\varphi _j ^-, \varphi _j ^+) =
-        (1-u) min(\varphi _j ^-, \varphi _j^+)
-      + u max(\varphi _j ^-, \varphi _j^+)
+  \f[ score(\varphi _j ^- f_j ^-, \varphi _j ^+ f_j ^+) =
+        (1-u) min(\varphi _j ^- f_j ^-, \varphi _j^+ f_j ^+)
+      + u max(\varphi _j ^- f_j ^-, \varphi _j^+ f_j ^+)
   \f]
 
-  where u is called the scale factor and it is fixed to 1/6.
+  where u is called the scale factor and it is 1 - pseudoWeight. When
+  pseudoProductScore is set the score is the product of the two estimates,
+  each bounded below by a small positive value.
 
   We branch on the maximum score variable.
 
+  When coneBranchWeight is positive scores of candidates that are members of
+  violated relaxed cones are increased in proportion to the violation of
+  these cones. Under OA this prefers integers that also take part in the
+  conic infeasibility of the node.
+
+  Pseudocosts of a direction with no observations are initialized to the
+  average of all observations in that direction, 1 if there are none.
+  Observations come from branched nodes, strong branching of
+  DcoBranchStrategyRel and infeasible children. An infeasible child is
+  recorded as pseudoInfPenalty times the average pseudocost of its
+  direction.
+
+  In parallel runs observations of nodes up to sharePcostDepth are sent to
+  other processes through DcoModel::packSharedKnowlege(). Received
+  observations are merged into the averages weighted by their counts.
+
   # Design, keeping statistics
   How do we update \f$ \varphi \f$, since optimal value of the children are not
   known before solving the children's subproblem.
@@ -68,8 +88,17 @@ class DcoTreeNode;
  */
 
 class DcoBranchStrategyPseudo: virtual public BcpsBranchStrategy {
+protected:
   /// score factor used. See class documentation.
   double score_factor_;
+  /// True if score is the product of down and up estimates.
+  bool product_score_;
+  /// Infeasible children are recorded as this many times the average.
+  double inf_penalty_;
+  /// Weight of cone violation in scores, coneBranchWeight.
+  double cone_weight_;
+  /// Scores of relaxed columns are multiplied by these, see setConeFactors().
+  std::vector<double> cone_factor_;
   ///@name Statistics
   //@{
   /// number of observations for each integer variable
@@ -80,15 +109,68 @@ class DcoBranchStrategyPseudo: virtual public BcpsBranchStrategy {
   /// these are \f$ \varphi \f$ variables in the documentation
   double * down_derivative_;
   double * up_derivative_;
+  /// sum and number of all observations in each direction.
+  double down_sum_;
+  double up_sum_;
+  int down_total_;
+  int up_total_;
   /// reverse map of relaxed columns, rev_relaxed_[index] gives the index of
-  /// the varaible in relaxed columns array.
-  std::map<int,int> rev_relaxed_;
+  /// the varaible in relaxed columns array, -1 for other columns.
+  std::vector<int> rev_relaxed_;
+  //@}
+  ///@name Sharing statistics with other processes
+  //@{
+  /// number and sum of the observations recorded since the last share
+  int * down_shared_num_;
+  int * up_shared_num_;
+  double * down_shared_sum_;
+  double * up_shared_sum_;
+  /// relaxed columns that have observations to share
+  std::vector<int> shared_cols_;
+  /// observations are shared for nodes up to this depth, sharePcostDepth.
+  int share_depth_;
+  /// true if observations of the current node are shared.
+  bool record_shared_;
+  //@}
   /// update scores of the stored branch objects.
   void update_statistics(DcoTreeNode * node);
+  /// Merge num observations summing to sum into the pseudocost of relaxed
+  /// column i in direction dir.
+  void mergePseudocost(int i, int dir, int num, double sum);
+  /// Add an observation of objective change per unit change, deriv, to the
+  /// pseudocost of relaxed column i in direction dir.
+  void updatePseudocost(int i, int dir, double deriv);
+  /// Score of a candidate from its down and up estimates, see class
+  /// documentation.
+  double computeScore(double down, double up) const;
+  /// Average of all observations in direction dir, 1 if there are none.
+  double averagePseudocost(int dir) const;
+  /// Pseudocost of relaxed column i in direction dir, average of all
+  /// observations in that direction if column has none.
+  double pseudocost(int i, int dir) const;
+  /// Score of relaxed column i with value estimated by pseudocosts,
+  /// multiplied by its cone factor.
+  double pseudoScore(int i, double value) const;
+  /// Compute cone factors of infeasible relaxed columns for the solution in
+  /// solver, 1 + cone_weight_ times the violation of the relaxed cones the
+  /// column is a member of relative to the largest violation.
+  void setConeFactors();
 public:
   DcoBranchStrategyPseudo(DcoModel * model);
   virtual ~DcoBranchStrategyPseudo();
   virtual int createCandBranchObjects(BcpsTreeNode * node);
+  /// Record the infeasible child node as a pseudocost observation of the
+  /// column branched to create it.
+  void infeasibleChild(DcoTreeNode * node);
+  ///@name Sharing statistics with other processes
+  //@{
+  /// Number of relaxed columns with observations to share.
+  int numShared() const { return static_cast<int>(shared_cols_.size()); }
+  /// Pack the observations recorded since the last call and clear them.
+  void packShared(AlpsEncoded * encoded);
+  /// Merge the observations packed by packShared() of another process.
+  void unpackShared(AlpsEncoded & encoded);
+  //@}
   /// Compare current to other, return 1 if current is better, 0 otherwise
   virtual int betterBranchObject(BcpsBranchObject const * current,
                                  BcpsBranchObject const * other);
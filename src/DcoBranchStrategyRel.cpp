@@ -13,3 +13,156 @@
  *                          Ted Ralphs.                                      *
  * All Rights Reserved.                                                      *
  *===========================================================================*/
+
+
+#include "DcoBranchStrategyRel.hpp"
+#include "DcoModel.hpp"
+#include "DcoMessage.hpp"
+#include "DcoTreeNode.hpp"
+#include "DcoBranchObject.hpp"
+
+#include <algorithm>
+
+DcoBranchStrategyRel::DcoBranchStrategyRel(DcoModel * model,
+                                           int reliability):
+  BcpsBranchStrategy(model), DcoBranchStrategyPseudo(model) {
+  setType(DcoBranchingStrategyReliability);
+  reliability_ = reliability;
+  lookAhead_ = model->dcoPar()->entry(DcoParams::lookAhead);
+}
+
+double DcoBranchStrategyRel::childChange(double obj) const {
+  OsiSolverInterface * solver = dynamic_cast<DcoModel*>(model())->solver();
+  if (solver->isProvenPrimalInfeasible() or
+      solver->isDualObjectiveLimitReached()) {
+    return ALPS_INFINITY;
+  }
+  if (solver->isProvenOptimal() or solver->isIterationLimitReached()) {
+    return fabs(solver->getObjValue()-obj);
+  }
+  return -1.0;
+}
+
+double DcoBranchStrategyRel::strongScore(int i, double value,
+                                         BcpsBranchObject const * bobject,
+                                         double obj) {
+  OsiSolverInterface * solver = dynamic_cast<DcoModel*>(model())->solver();
+  DcoBranchObject const * dco_bobject =
+    dynamic_cast<DcoBranchObject const *>(bobject);
+  int index = bobject->index();
+  double lb = solver->getColLower()[index];
+  double ub = solver->getColUpper()[index];
+  // solve down branch
+  solver->setColUpper(index, dco_bobject->ubDownBranch());
+  solver->solveFromHotStart();
+  double down = childChange(obj);
+  solver->setColUpper(index, ub);
+  // solve up branch
+  solver->setColLower(index, dco_bobject->lbUpBranch());
+  solver->solveFromHotStart();
+  double up = childChange(obj);
+  solver->setColLower(index, lb);
+  // record observations of the solved children, infeasible children are
+  // penalized.
+  if (down>=ALPS_INFINITY) {
+    updatePseudocost(i, DcoNodeBranchDirectionDown,
+         inf_penalty_*averagePseudocost(DcoNodeBranchDirectionDown));
+  }
+  else if (down>=0.0) {
+    updatePseudocost(i, DcoNodeBranchDirectionDown,
+                     down/(value-floor(value)));
+  }
+  if (up>=ALPS_INFINITY) {
+    updatePseudocost(i, DcoNodeBranchDirectionUp,
+         inf_penalty_*averagePseudocost(DcoNodeBranchDirectionUp));
+  }
+  else if (up>=0.0) {
+    updatePseudocost(i, DcoNodeBranchDirectionUp, up/(ceil(value)-value));
+  }
+  return computeScore(CoinMax(down, 0.0), CoinMax(up, 0.0));
+}
+
+int DcoBranchStrategyRel::createCandBranchObjects(BcpsTreeNode * node) {
+  // get node
+  DcoTreeNode * dco_node = dynamic_cast<DcoTreeNode*>(node);
+  // update statistics
+  update_statistics(dco_node);
+  // get dco model and message stuff
+  DcoModel * dco_model = dynamic_cast<DcoModel*>(model());
+  CoinMessageHandler * message_handler = dco_model->dcoMessageHandler_;
+  CoinMessages * messages = dco_model->dcoMessages_;
+  OsiSolverInterface * solver = dco_model->solver();
+  // get indices of relaxed object
+  int const * relaxed = dco_model->relaxedCols();
+  // integrality of relaxed columns, computed once for the solution.
+  dco_model->checkIntegrality();
+  int num_inf = dco_model->numInfRelaxed();
+  int const * inf_relaxed = dco_model->infRelaxed();
+  int const * dir = dco_model->relaxedDir();
+  // current solution, strong branching changes the one in solver.
+  int num_cols = solver->getNumCols();
+  std::vector<double> sol(solver->getColSolution(),
+                          solver->getColSolution()+num_cols);
+  double const obj_val = solver->getObjValue();
+  int iter_limit = dco_model->dcoPar()->entry(DcoParams::strongIterLimit);
+  // cone factors of candidates, computed before strong branching changes
+  // the solution in solver.
+  setConeFactors();
+  // create branch objects, order them by decreasing pseudocost score
+  std::vector<BcpsBranchObject*> bobjects(num_inf);
+  std::vector<std::pair<double, int> > order(num_inf);
+  for (int k=0; k<num_inf; ++k) {
+    int i = inf_relaxed[k];
+    BcpsObject * curr_object = dco_model->getVariables()[relaxed[i]];
+    bobjects[k] = curr_object->createBranchObject(dco_model, dir[i]);
+    order[k] = std::make_pair(-pseudoScore(i, sol[relaxed[i]]), k);
+  }
+  std::stable_sort(order.begin(), order.end());
+  // strong branch unreliable candidates until look ahead is exhausted
+  bool hot_start = false;
+  double best_score = -1.0;
+  int num_no_improve = 0;
+  for (int n=0; n<num_inf; ++n) {
+    int k = order[n].second;
+    int i = inf_relaxed[k];
+    double value = sol[relaxed[i]];
+    double score = -order[n].first;
+    bool strong = num_no_improve<lookAhead_ and
+      CoinMin(down_num_[i], up_num_[i])<reliability_;
+    if (strong) {
+      if (!hot_start) {
+        solver->markHotStart();
+        solver->setIntParam(OsiMaxNumIterationHotStart, iter_limit);
+        hot_start = true;
+      }
+      score = strongScore(i, value, bobjects[k], obj_val)*cone_factor_[i];
+      solver->setColSolution(&sol[0]);
+    }
+    bobjects[k]->setScore(score);
+    if (score>best_score) {
+      best_score = score;
+      num_no_improve = 0;
+    }
+    else if (strong) {
+      num_no_improve++;
+    }
+
+    // debug stuff
+    message_handler->message(DISCO_REL_REPORT, *messages)
+      << dco_model->broker()->getProcRank()
+      << relaxed[i]
+      << score
+      << static_cast<int>(strong)
+      << CoinMessageEol;
+  }
+  if (hot_start) {
+    solver->unmarkHotStart();
+  }
+  // add branch objects to branchObjects_
+  setBranchObjects(bobjects);
+  // bobjects are now owned by BcpsBranchStrategy, do not free them.
+  bobjects.clear();
+  // set the branch object member of the node
+  dco_node->setBranchObject(new DcoBranchObject(bestBranchObject()));
+  return 0;
+}
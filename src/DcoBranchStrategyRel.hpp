@@ -13,3 +13,68 @@
  *                          Ted Ralphs.                                      *
  * All Rights Reserved.                                                      *
  *===========================================================================*/
+
+
+#ifndef DcoBranchStrategyRel_hpp_
+#define DcoBranchStrategyRel_hpp_
+
+#include "DcoBranchStrategyPseudo.hpp"
+
+class BcpsBranchObject;
+
+/*!
+  Implements reliability branching, see Achterberg's PhD dissertation.
+
+  Candidates are the fractional relaxed columns, they are considered in
+  decreasing order of their pseudocost scores. Pseudocosts of a column are
+  reliable once both of its directions have #reliability_ observations.
+  Candidates with unreliable pseudocosts are strong branched using hot start,
+  objective changes of the children are recorded as pseudocost observations
+  and they give the score of the candidate. Reliable candidates are scored
+  with their pseudocosts as in DcoBranchStrategyPseudo.
+
+  Strong branching stops when the best score does not improve for
+  #lookAhead_ strong branched candidates, the remaining candidates are
+  scored with their pseudocosts.
+*/
+
+class DcoBranchStrategyRel: public DcoBranchStrategyPseudo {
+  /// Number of observations needed in each direction for the pseudocosts of
+  /// a column to be reliable.
+  int reliability_;
+  /// Strong branching stops after this many candidates that do not improve
+  /// the best score.
+  int lookAhead_;
+  /// Strong branch on relaxed column i with value, bobject is its branch
+  /// object and obj is the objective value of the node. Records the
+  /// observations and returns the score.
+  double strongScore(int i, double value, BcpsBranchObject const * bobject,
+                     double obj);
+  /// Objective change of the child solved last by hot start. Returns
+  /// ALPS_INFINITY if the child is infeasible and -1.0 if it is not solved.
+  double childChange(double obj) const;
+public:
+  ///@name Constructor and Destructor.
+  //@{
+  /// Constructor.
+  DcoBranchStrategyRel(DcoModel * model, int reliability);
+  /// Destructor.
+  virtual ~DcoBranchStrategyRel() {}
+  //@}
+
+  ///@name Selecting and Creating branches.
+  //@{
+  /// Create a set of candidate branching objects from the given node.
+  virtual int createCandBranchObjects(BcpsTreeNode * node);
+  //@}
+
+private:
+  /// Disable default constructor.
+  DcoBranchStrategyRel();
+  /// Disable copy constructor.
+  DcoBranchStrategyRel(DcoBranchStrategyRel const & other);
+  /// Disable copy assignment operator.
+  DcoBranchStrategyRel & operator=(DcoBranchStrategyRel const & rhs);
+};
+
+#endif
@@ -20,6 +20,10 @@
 #include "DcoMessage.hpp"
 #include "DcoTreeNode.hpp"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 
 DcoBranchStrategyStrong::DcoBranchStrategyStrong(DcoModel * model)
   : BcpsBranchStrategy(model) {
@@ -27,66 +31,64 @@ DcoBranchStrategyStrong::DcoBranchStrategyStrong(DcoModel * model)
 }
 
 // Assumes problem is not unbounded.
-void DcoBranchStrategyStrong::updateScore(BcpsBranchObject * bobject,
-                                            double orig_lb,
-                                            double orig_ub,
-                                            double orig_obj) const {
-  // get dco model and message stuff
-  DcoModel * dco_model = dynamic_cast<DcoModel*>(model());
-  // CoinMessageHandler * message_handler = dco_model->dcoMessageHandler_;
-  // CoinMessages * messages = dco_model->dcoMessages_;
-  DcoBranchObject * dco_bobject = dynamic_cast<DcoBranchObject*>(bobject);
+double DcoBranchStrategyStrong::strongScore(OsiSolverInterface * solver,
+                                            int index, double value,
+                                            double quality,
+                                            double & downQuality,
+                                            double & upQuality,
+                                            CoinWarmStartBasis *& downBasis,
+                                            CoinWarmStartBasis *& upBasis)
+  const {
+  double orig_lb = solver->getColLower()[index];
+  double orig_ub = solver->getColUpper()[index];
   // solve subproblem for the down branch
-  dco_model->solver()->setColUpper(bobject->index(), dco_bobject->ubDownBranch());
-  dco_model->solver()->solveFromHotStart();
-  //double down_obj = 0.5*ALPS_INFINITY;
-  double down_obj = 1.0;
-  // std::cout << "abandoned " << dco_model->solver()->isAbandoned()<< std::endl;
-  // std::cout << "optimal " << dco_model->solver()->isProvenOptimal()<< std::endl;
-  // std::cout << "primal inf" << dco_model->solver()->isProvenPrimalInfeasible()<< std::endl;
-  // std::cout << "dual inf" << dco_model->solver()->isProvenDualInfeasible()<< std::endl;
-  // std::cout << "primal obj limit" << dco_model->solver()->isPrimalObjectiveLimitReached()<< std::endl;
-  // std::cout << "dual obj limit" << dco_model->solver()->isDualObjectiveLimitReached()<< std::endl;
-  // std::cout << "iter limit" << dco_model->solver()->isIterationLimitReached()<< std::endl;
-  if (dco_model->solver()->isProvenOptimal()
-      or dco_model->solver()->isIterationLimitReached()
-      or dco_model->solver()->isDualObjectiveLimitReached()) {
-    down_obj = dco_model->solver()->getObjValue();
-  }
-  else {
-    std::cout << "prob not opt." << std::endl;
-  }
+  solver->setColUpper(index, floor(value));
+  solver->solveFromHotStart();
+  downQuality = childQuality(solver, downBasis);
   // restore bound
-  dco_model->solver()->setColUpper(bobject->index(), orig_ub);
+  solver->setColUpper(index, orig_ub);
   // solve subproblem for the up branch
-  dco_model->solver()->setColLower(bobject->index(), dco_bobject->lbUpBranch());
-  dco_model->solver()->solveFromHotStart();
-  //double up_obj = 0.5*ALPS_INFINITY;
-  double up_obj = 1.0;
-  // std::cout << "abandoned " << dco_model->solver()->isAbandoned()<< std::endl;
-  // std::cout << "optimal " << dco_model->solver()->isProvenOptimal()<< std::endl;
-  // std::cout << "primal inf" << dco_model->solver()->isProvenPrimalInfeasible()<< std::endl;
-  // std::cout << "dual inf" << dco_model->solver()->isProvenDualInfeasible()<< std::endl;
-  // std::cout << "primal obj limit" << dco_model->solver()->isPrimalObjectiveLimitReached()<< std::endl;
-  // std::cout << "dual obj limit" << dco_model->solver()->isDualObjectiveLimitReached()<< std::endl;
-  // std::cout << "iter limit" << dco_model->solver()->isIterationLimitReached()<< std::endl;
-  if (dco_model->solver()->isProvenOptimal()
-      or dco_model->solver()->isIterationLimitReached()
-      or dco_model->solver()->isDualObjectiveLimitReached()) {
-    up_obj = dco_model->solver()->getObjValue();
-  }
-  else {
-    std::cout << "prob not opt." << std::endl;
-  }
+  solver->setColLower(index, ceil(value));
+  solver->solveFromHotStart();
+  upQuality = childQuality(solver, upBasis);
   // restore bound
-  dco_model->solver()->setColLower(bobject->index(), orig_lb);
-  // set score
-  double down_diff = fabs(orig_obj-down_obj);
-  double up_diff = fabs(orig_obj-up_obj);
-  double score = down_diff>up_diff ? down_diff : up_diff;
-  bobject->setScore(score);
+  solver->setColLower(index, orig_lb);
+  // infeasible children have infinite change, unsolved ones no change.
+  double diff[2] = {downQuality, upQuality};
+  for (int k=0; k<2; ++k) {
+    if (diff[k]>=ALPS_OBJ_MAX) {
+      diff[k] = ALPS_INFINITY;
+    }
+    else if (diff[k]<=-ALPS_OBJ_MAX) {
+      diff[k] = 0.0;
+    }
+    else {
+      diff[k] = fabs(diff[k]-quality);
+    }
+  }
+  return diff[0]>diff[1] ? diff[0] : diff[1];
 }
 
+double
+DcoBranchStrategyStrong::childQuality(OsiSolverInterface const * solver,
+                                      CoinWarmStartBasis *& basis) const {
+  basis = NULL;
+  if (solver->isProvenPrimalInfeasible()
+      or solver->isDualObjectiveLimitReached()) {
+    return ALPS_OBJ_MAX;
+  }
+  if (solver->isProvenOptimal()
+      or solver->isIterationLimitReached()) {
+    CoinWarmStart * ws = solver->getWarmStart();
+    basis = dynamic_cast<CoinWarmStartBasis*>(ws);
+    if (basis==NULL) {
+      delete ws;
+    }
+    return solver->getObjValue()*solver->getObjSense();
+  }
+  // child is not solved, no information.
+  return -ALPS_OBJ_MAX;
+}
 
 double DcoBranchStrategyStrong::infeas(double value) const {
   // get dco model and message stuff
@@ -134,55 +136,128 @@ int DcoBranchStrategyStrong::createCandBranchObjects(BcpsTreeNode * node) {
             +dco_model->solver()->getNumCols(),
             sol);
 
-  // create data to keep branching objects
+  // candidates are the fractional relaxed columns
+  std::vector<int> cands;
+  for (int i=0; i<num_relaxed; ++i) {
+    if (infeas(sol[relaxed[i]])) {
+      cands.push_back(relaxed[i]);
+    }
+  }
+  int num_cands = static_cast<int>(cands.size());
+  if (num_cands==0) {
+    delete[] sol;
+    std::cout << "All columns are feasible." << std::endl;
+    throw std::exception();
+  }
+
+  // solve children of the candidates and compute their scores.
+  OsiSolverInterface * solver = dco_model->solver();
+  int iter_limit = dco_model->dcoPar()->entry(DcoParams::strongIterLimit);
+  double const quality = solver->getObjValue()*solver->getObjSense();
+  std::vector<double> scores(num_cands, 0.0);
+  std::vector<double> down_quality(num_cands);
+  std::vector<double> up_quality(num_cands);
+  std::vector<CoinWarmStartBasis*> down_basis(num_cands);
+  std::vector<CoinWarmStartBasis*> up_basis(num_cands);
+  int num_threads = 1;
+#ifdef _OPENMP
+  num_threads = dco_model->dcoPar()->entry(DcoParams::strongThreads);
+  num_threads = CoinMax(CoinMin(num_threads, num_cands), 1);
+  if (num_threads>1) {
+    // each thread owns a clone of the solver warm started from the basis
+    // of the node.
+    CoinWarmStart * ws = solver->getWarmStart();
+    std::vector<OsiSolverInterface*> clones(num_threads);
+    for (int t=0; t<num_threads; ++t) {
+      clones[t] = solver->clone(true);
+      clones[t]->setWarmStart(ws);
+      clones[t]->markHotStart();
+      clones[t]->setIntParam(OsiMaxNumIterationHotStart, iter_limit);
+    }
+    delete ws;
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+    for (int c=0; c<num_cands; ++c) {
+      OsiSolverInterface * clone = clones[omp_get_thread_num()];
+      scores[c] = strongScore(clone, cands[c], sol[cands[c]], quality,
+                              down_quality[c], up_quality[c],
+                              down_basis[c], up_basis[c]);
+    }
+    for (int t=0; t<num_threads; ++t) {
+      clones[t]->unmarkHotStart();
+      delete clones[t];
+    }
+  }
+#endif
+  if (num_threads==1) {
+    solver->markHotStart();
+    solver->setIntParam(OsiMaxNumIterationHotStart, iter_limit);
+    for (int c=0; c<num_cands; ++c) {
+      scores[c] = strongScore(solver, cands[c], sol[cands[c]], quality,
+                              down_quality[c], up_quality[c],
+                              down_basis[c], up_basis[c]);
+      solver->setColSolution(sol);
+    }
+    solver->unmarkHotStart();
+  }
+
+  // a candidate with an infeasible child gives a bound on its column that
+  // holds in this node. If both children are infeasible, so is the node,
+  // the candidate gets the highest score and its children are fathomed.
+  std::vector<int> fix_index;
+  std::vector<double> fix_lb;
+  std::vector<double> fix_ub;
+  double const * col_lb = solver->getColLower();
+  double const * col_ub = solver->getColUpper();
+  for (int c=0; c<num_cands; ++c) {
+    bool down_inf = down_quality[c]>=ALPS_OBJ_MAX;
+    bool up_inf = up_quality[c]>=ALPS_OBJ_MAX;
+    if (down_inf==up_inf) {
+      continue;
+    }
+    double value = sol[cands[c]];
+    fix_index.push_back(cands[c]);
+    fix_lb.push_back(down_inf ? ceil(value) : col_lb[cands[c]]);
+    fix_ub.push_back(up_inf ? floor(value) : col_ub[cands[c]]);
+  }
+
+  // keep the best candidates. Candidates are visited in the same order
+  // whatever the number of threads is, ties are broken the same way.
   int cand_cap = dco_model->dcoPar()->entry(DcoParams::strongCandSize);
-  cand_cap = CoinMax(CoinMin(cand_cap, num_relaxed), 1);
+  cand_cap = CoinMax(CoinMin(cand_cap, num_cands), 1);
   BcpsBranchObject ** bobjects = new BcpsBranchObject*[cand_cap];
   int num_bobjects = 0;
   // pos is the index of the minimum score branch object
   int min_pos = -1;
   double min_score = ALPS_INFINITY;
-
-  dco_model->solver()->markHotStart();
-  dco_model->solver()->setIntParam(OsiMaxNumIterationHotStart, 50);
-
-  double const obj_val = dco_model->solver()->getObjValue();
-  //double const * collb = dco_model->colLB();
-  //double const * colub = dco_model->colUB();
-  double const * collb = dco_model->solver()->getColLower();
-  double const * colub = dco_model->solver()->getColUpper();
-
-  // iterate over integer cols, create branch objects, solve corresponding
-  // relaxed problems and set scores.
-  for (int i=0; i<num_relaxed; ++i) {
-    // get corresponding variable
-    int var_index = relaxed[i];
-    // go to next if not infeasible
-    if (!infeas(sol[var_index])) {
-      continue;
-    }
-    // score is 0.0 for now, we will set it later
-    BcpsBranchObject * curr_branch_object =
-      new DcoBranchObject(var_index, 0.0, sol[var_index]);
-    updateScore(curr_branch_object, collb[var_index],
-                colub[var_index], obj_val);
-    double curr_score = curr_branch_object->score();
-    dco_model->solver()->setColSolution(sol);
-
+  for (int c=0; c<num_cands; ++c) {
+    int var_index = cands[c];
+    double curr_score = scores[c];
     // if we have capacity add branch object
     // else check whether current performs better than the worst candidate
     // if it is add it to candidates.
+    if (num_bobjects==cand_cap and curr_score<=min_score) {
+      // score is not enough to be a candidate
+      continue;
+    }
+    DcoBranchObject * curr_object =
+      new DcoBranchObject(var_index, curr_score, sol[var_index]);
+    // branch object owns the bases now.
+    curr_object->setChildren(down_quality[c], up_quality[c],
+                             down_basis[c], up_basis[c]);
+    down_basis[c] = NULL;
+    up_basis[c] = NULL;
+    curr_object->setFixings(fix_index, fix_lb, fix_ub);
     if (num_bobjects<cand_cap) {
-      bobjects[num_bobjects] = curr_branch_object;
+      bobjects[num_bobjects] = curr_object;
       if (curr_score<min_score) {
         min_score = curr_score;
         min_pos = num_bobjects;
       }
       num_bobjects++;
     }
-    else if (curr_score>min_score) {
+    else {
       delete bobjects[min_pos];
-      bobjects[min_pos] = curr_branch_object;
+      bobjects[min_pos] = curr_object;
       // find new minimum score candidate
       min_score = ALPS_INFINITY;
       for (int k=0; k<cand_cap; ++k) {
@@ -192,16 +267,13 @@ int DcoBranchStrategyStrong::createCandBranchObjects(BcpsTreeNode * node) {
         }
       }
     }
-    else {
-      // score is not enough to be a candidate
-    }
   }
-  delete[] sol;
-  if (num_bobjects==0) {
-    std::cout << "All columns are feasible." << std::endl;
-    throw std::exception();
+  // free bases of the candidates that are not kept
+  for (int c=0; c<num_cands; ++c) {
+    delete down_basis[c];
+    delete up_basis[c];
   }
-  dco_model->solver()->unmarkHotStart();
+  delete[] sol;
 
   // debug stuff
   for (int i=0; i<num_bobjects; ++i) {
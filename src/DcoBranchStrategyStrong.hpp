@@ -29,9 +29,19 @@
 */
 
 class DcoBranchStrategyStrong : virtual public BcpsBranchStrategy {
-  /// update score for the given branch object.
-  void updateScore(BcpsBranchObject * bobject, double orig_lb,
-                   double orig_ub, double orig_obj) const;
+  /// Score of branching on column index with the given value. Children are
+  /// solved with hot start on solver, quality is the quality of the node.
+  /// Quality and basis of the children are returned in the last arguments,
+  /// bases are NULL for infeasible or unsolved children.
+  double strongScore(OsiSolverInterface * solver, int index, double value,
+                     double quality, double & downQuality,
+                     double & upQuality, CoinWarmStartBasis *& downBasis,
+                     CoinWarmStartBasis *& upBasis) const;
+  /// Quality of the child solved last by solver and its basis. Quality is
+  /// ALPS_OBJ_MAX if the child is infeasible and -ALPS_OBJ_MAX if it is not
+  /// solved.
+  double childQuality(OsiSolverInterface const * solver,
+                      CoinWarmStartBasis *& basis) const;
   // return integer infeasibility for the given value
   double infeas(double value) const;
  public:
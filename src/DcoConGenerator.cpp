@@ -16,6 +16,7 @@
 
 
 #include "DcoConGenerator.hpp"
+#include "DcoModel.hpp"
 
 void DcoConGeneratorStats::reset() {
   numConsGenerated_ = 0;
@@ -32,9 +33,17 @@ DcoConGenerator::DcoConGenerator(DcoModel * model,
                                  int frequency):
   name_(name), type_(type), model_(model), strategy_(strategy),
   frequency_(frequency) {
+  solver_ = NULL;
   stats_.reset();
 }
 
 DcoConGenerator::~DcoConGenerator() {
   model_ = NULL;
 }
+
+OsiSolverInterface * DcoConGenerator::solver() const {
+  if (solver_) {
+    return solver_;
+  }
+  return model_->solver();
+}
@@ -20,6 +20,7 @@
 
 #include "Dco.hpp"
 #include <string>
+#include <vector>
 #include <BcpsObjectPool.h>
 
 /*!
@@ -28,6 +29,8 @@
 */
 
 class DcoModel;
+class DcoLinearConstraint;
+class OsiSolverInterface;
 
 class DcoConGeneratorStats {
   /// Number of constraints generated by this generator.
@@ -87,8 +90,15 @@ class DcoConGenerator {
   DcoConstraintType const type_;
   /// The client model.
   DcoModel * model_;
+  /// Solver constraints are generated from, NULL for the solver of the
+  /// model. Set to a private snapshot when generators run concurrently.
+  OsiSolverInterface * solver_;
   /// Statistics of this generator.
   DcoConGeneratorStats stats_;
+  /// Constraints of the last call that are valid for all nodes. They are
+  /// owned by the constraint pool, the caller adds them to the global cut
+  /// pool once generators are done.
+  std::vector<DcoLinearConstraint*> shared_;
   //@}
 
   ///@name Constraint Generation Control
@@ -124,12 +134,23 @@ public:
   /// Set frequency
   void setFrequency(int freq) { frequency_ = freq; }
   void setStrategy(DcoCutStrategy strat) { strategy_ = strat; }
+  /// Set solver to generate constraints from, NULL for the model's solver.
+  void setSolver(OsiSolverInterface * solver) { solver_ = solver; }
+  /// Mark a generated constraint as valid for all nodes.
+  void shareConstraint(DcoLinearConstraint * con) { shared_.push_back(con); }
+  /// Forget constraints marked by shareConstraint().
+  void clearShared() { shared_.clear(); }
   //@}
 
   /// Querry functions.
   //@{
   /// Get a pointer to the model.
   DcoModel * model() const { return model_; }
+  /// Get solver to generate constraints from.
+  OsiSolverInterface * solver() const;
+  /// Get constraints marked by shareConstraint() since last clearShared().
+  std::vector<DcoLinearConstraint*> const & sharedConstraints() const
+  { return shared_; }
   /// Get the name of this generator.
   std::string name() const { return name_; }
   /// Get the constraint generation strategy.
@@ -34,6 +34,37 @@ DcoConicConGenerator::DcoConicConGenerator(DcoModel * model,
                         int frequency):
   DcoConGenerator(model, type, name, strategy, frequency) {
   generator_ = generator;
+  setupCones();
+}
+
+/// Build cone layout from the model, cones are relaxed rows.
+void DcoConicConGenerator::setupCones() {
+  DcoModel * model = DcoConGenerator::model();
+  CoinMessageHandler * message_handler = model->dcoMessageHandler_;
+  CoinMessages * messages = model->dcoMessages_;
+  int num_cones = model->numRelaxedRows();
+  int const * start = model->coneStart();
+  int const * type = model->coneType();
+  int num_members = num_cones ? start[num_cones] : 0;
+  coneMembers_.assign(model->coneMembers(),
+                      model->coneMembers()+num_members);
+  coneStart_.assign(start, start+num_cones+1);
+  coneTypes_.resize(num_cones);
+  for (int i=0; i<num_cones; ++i) {
+    if (type[i]==1) {
+      coneTypes_[i] = OSI_QUAD;
+    }
+    else if (type[i]==2) {
+      coneTypes_[i] = OSI_RQUAD;
+    }
+    else {
+      message_handler->message(DISCO_UNKNOWN_CONETYPE, *messages)
+        << __FILE__ << __LINE__ << CoinMessageEol;
+    }
+  }
+  members_.reserve(num_cones);
+  sizes_.reserve(num_cones);
+  types_.reserve(num_cones);
 }
 
 /// Destructor.
@@ -46,70 +77,69 @@ bool DcoConicConGenerator::generateConstraints(BcpsConstraintPool & conPool) {
   DcoModel * model = DcoConGenerator::model();
   CoinMessageHandler * message_handler = model->dcoMessageHandler_;
   CoinMessages * messages = model->dcoMessages_;
+  // cones to separate, all relaxed cones or only the violated ones.
+  int num_cones = static_cast<int>(coneTypes_.size());
+  int const * cone_ind = NULL;
+  if (model->dcoPar()->entry(DcoParams::separateViolatedCones)) {
+    model->checkConeFeasibility();
+    num_cones = model->numInfCones();
+    cone_ind = model->infCones();
+  }
+  if (num_cones==0) {
+    return false;
+  }
+
+  // cone members, sizes and types, pointers into the cone layout
+  members_.clear();
+  sizes_.clear();
+  types_.clear();
+  for (int k=0; k<num_cones; ++k) {
+    int i = cone_ind ? cone_ind[k] : k;
+    members_.push_back(&coneMembers_[coneStart_[i]]);
+    sizes_.push_back(coneStart_[i+1]-coneStart_[i]);
+    types_.push_back(coneTypes_[i]);
+  }
   // generated cuts will be stored in this
   OsiCuts * cuts = new OsiCuts();
   // cut generator needs solver interface, get it.
-  OsiSolverInterface const * solver = model->solver();
-  // get conic constraint information
-  std::vector<BcpsConstraint*> & rows = model->getConstraints();
-  int num_cones = model->numRelaxedRows();
-
-  // cone members, sizes and types
-  int ** members = new int*[num_cones];
-  int * sizes = new int[num_cones];
-  OsiLorentzConeType * types = new OsiLorentzConeType[num_cones];
-
-  // iterate over conic constraints and collect cone information
-  for (int i=0; i<num_cones; ++i) {
-    DcoConicConstraint * curr = dynamic_cast<DcoConicConstraint*>
-      (rows[model->relaxedRows()[i]]);
-    sizes[i] = curr->coneSize();
-    members[i] = new int[sizes[i]];
-    std::copy(curr->coneMembers(), curr->coneMembers()+sizes[i], members[i]);
-    DcoLorentzConeType tt = curr->coneType();
-    if (tt==DcoLorentzCone) {
-      types[i] = OSI_QUAD;
-    }
-    else if (tt==DcoRotatedLorentzCone) {
-      types[i] = OSI_RQUAD;
-    }
-    else {
-      message_handler->message(DISCO_UNKNOWN_CONETYPE, *messages)
-        << __FILE__ << __LINE__ << CoinMessageEol;
-    }
-  }
+  OsiSolverInterface const * solver = DcoConGenerator::solver();
   // call cut generator
-  generator_->generateCuts(*solver, *cuts, num_cones, types,
-                           sizes, members, 1);
+  generator_->generateCuts(*solver, *cuts, num_cones, &types_[0],
+                           &sizes_[0], &members_[0], 1);
 
-  // debug message
-  message_handler->message(DISCO_CUT_GENERATED, *messages)
-    << model->broker()->getProcRank()
-    // todo(aykut) fix name
-    << dcoConstraintTypeName[type()]
-    << cuts->sizeRowCuts()
-    << CoinMessageEol;
+  // debug message, generators may run concurrently.
+#ifdef _OPENMP
+#pragma omp critical (DcoMessage)
+#endif
+  {
+    message_handler->message(DISCO_CUT_GENERATED, *messages)
+      << model->broker()->getProcRank()
+      // todo(aykut) fix name
+      << dcoConstraintTypeName[type()]
+      << cuts->sizeRowCuts()
+      << CoinMessageEol;
+  }
   // end of debug
 
   // add cuts to the constraint pool
+  bool share = type()==DcoConstraintTypeOA and
+    model->dcoPar()->entry(DcoParams::shareConstraints);
   int num_cuts = cuts->sizeRowCuts();
   for (int i=0; i<num_cuts; ++i) {
     OsiRowCut & rcut = cuts->rowCut(i);
     int num_elem = rcut.row().getNumElements();
     int const * ind = rcut.row().getIndices();
     double const * val = rcut.row().getElements();
-    DcoConstraint * con =
+    DcoLinearConstraint * con =
       new DcoLinearConstraint(num_elem, ind, val, rcut.lb(), rcut.ub());
     con->setConstraintType(type());
     conPool.addConstraint(con);
+    // OA supports are valid for all nodes, share them.
+    if (share) {
+      shareConstraint(con);
+    }
   }
   delete cuts;
-  for (int i=0; i<num_cones; ++i) {
-    delete[] members[i];
-  }
-  delete[] members;
-  delete[] sizes;
-  delete[] types;
   if (num_cuts) {
     return true;
   }
@@ -20,11 +20,41 @@
 
 #include "DcoConGenerator.hpp"
 
+#include <OsiLorentzCone.hpp>
+#include <vector>
+
 class CglConicCutGenerator;
 
+/*!
+  Generates conic cuts with a CglConicCutGenerator. Cone layout of the
+  relaxed cones is built once at setup, each call passes the cones to
+  separate by pointers into it.
+*/
+
 class DcoConicConGenerator: virtual public DcoConGenerator {
   /// The CglCutGenerator object.
   CglConicCutGenerator * generator_;
+
+  ///@name Cone layout
+  /// Relaxed cone i is relaxed row i of the model.
+  //@{
+  /// Members of all relaxed cones, concatenated.
+  std::vector<int> coneMembers_;
+  /// Start of each cone in coneMembers_.
+  std::vector<int> coneStart_;
+  /// Type of each cone.
+  std::vector<OsiLorentzConeType> coneTypes_;
+  //@}
+
+  ///@name Cones passed to the Cgl generator, reused by calls.
+  //@{
+  std::vector<int*> members_;
+  std::vector<int> sizes_;
+  std::vector<OsiLorentzConeType> types_;
+  //@}
+
+  /// Build cone layout from the model.
+  void setupCones();
 public:
   ///@name Constructors and Destructor
   //@{
@@ -16,7 +16,6 @@
 
 
 #include "DcoConicConstraint.hpp"
-#include <numeric>
 
 DcoConicConstraint::DcoConicConstraint() {
   coneType_ = DcoLorentzCone;
@@ -105,29 +104,29 @@ double DcoConicConstraint::infeasibility(BcpsModel * m,
   double infeasibility;
   // get solution stored in solver
   double const * sol = model->solver()->getColSolution();
-  // get related portion of the solution
-  double * par_sol = new double[coneSize_];
-  for(int i=0; i<coneSize_; ++i) {
-    par_sol[i] = sol[members_[i]];
-  }
+  int const * m = members_;
   // get cone tolerance
   double cone_tol = model->dcoPar()->entry(DcoParams::coneTol);
   if (coneType_==DcoLorentzCone) {
     // infeasibility is
     // |x_2n| - x_1, if |x_2n| - x_1 > coneTol
     //  0 otherwise
-    double * p = par_sol;
-    double norm = std::inner_product(p+1, p+coneSize_, p+1, 0.0);
+    double norm = 0.0;
+    for (int i=1; i<coneSize_; ++i) {
+      norm += sol[m[i]]*sol[m[i]];
+    }
     norm = sqrt(norm);
-    infeasibility = norm - p[0];
+    infeasibility = norm - sol[m[0]];
   }
   else if (coneType_==DcoRotatedLorentzCone) {
     // infeasibility is
     // |x_3n|^2 - 2x_1x_2, if |x_3n|^2 - 2x_1x_2, > coneTol
     //  0 otherwise
-    double * p = par_sol;
-    double ss = std::inner_product(p+2, p+coneSize_, p+2, 0.0);
-    infeasibility = ss - 2.0*p[0]*p[1];
+    double ss = 0.0;
+    for (int i=2; i<coneSize_; ++i) {
+      ss += sol[m[i]]*sol[m[i]];
+    }
+    infeasibility = ss - 2.0*sol[m[0]]*sol[m[1]];
   }
   else {
     // unknown cone type.
@@ -138,7 +137,6 @@ double DcoConicConstraint::infeasibility(BcpsModel * m,
   if (infeasibility<=cone_tol) {
     infeasibility = 0.0;
   }
-  delete[] par_sol;
   return infeasibility;
 }
 
@@ -0,0 +1,147 @@
+/*===========================================================================*
+ * This file is part of the Discrete Conic Optimization (DisCO) Solver.      *
+ *                                                                           *
+ * DisCO is distributed under the Eclipse Public License as part of the      *
+ * COIN-OR repository (http://www.coin-or.org).                              *
+ *                                                                           *
+ * Authors:                                                                  *
+ *          Aykut Bulut, Lehigh University                                   *
+ *          Yan Xu, Lehigh University                                        *
+ *          Ted Ralphs, Lehigh University                                    *
+ *                                                                           *
+ * Copyright (C) 2001-2018, Lehigh University, Aykut Bulut, Yan Xu, and      *
+ *                          Ted Ralphs.                                      *
+ * All Rights Reserved.                                                      *
+ *===========================================================================*/
+
+
+#include "DcoCutPool.hpp"
+#include "DcoLinearConstraint.hpp"
+
+#include <CoinHelperFunctions.hpp>
+
+DcoCutPool::DcoCutPool() {
+  start_.push_back(0);
+  maxAge_ = 0;
+  numAdded_ = 0;
+  numDuplicate_ = 0;
+  numSeparated_ = 0;
+  numRemoved_ = 0;
+}
+
+bool DcoCutPool::addCut(DcoLinearConstraint const * con) {
+  if (con->getSize()<=0) {
+    return false;
+  }
+  std::size_t key = con->hashKey();
+  if (!keys_.insert(key).second) {
+    numDuplicate_++;
+    return false;
+  }
+  int size = con->getSize();
+  index_.insert(index_.end(), con->getIndices(), con->getIndices()+size);
+  value_.insert(value_.end(), con->getValues(), con->getValues()+size);
+  start_.push_back(static_cast<int>(index_.size()));
+  lb_.push_back(CoinMax(con->getLbHard(), con->getLbSoft()));
+  ub_.push_back(CoinMin(con->getUbHard(), con->getUbSoft()));
+  type_.push_back(con->constraintType());
+  key_.push_back(key);
+  age_.push_back(0);
+  numUsed_.push_back(0);
+  numAdded_++;
+  return true;
+}
+
+/// True if cuts of the type approximate cones.
+static bool isConicType(DcoConstraintType type) {
+  return type==DcoConstraintTypeIPM or type==DcoConstraintTypeIPMint or
+    type==DcoConstraintTypeOA or type==DcoConstraintTypeCMIR or
+    type==DcoConstraintTypeGD1;
+}
+
+int DcoCutPool::separate(double const * sol, int type, double coneTol,
+                         double integerTol, BcpsConstraintPool & conPool) {
+  int num_cuts = size();
+  int const * start = &start_[0];
+  int num_sep = 0;
+  for (int i=0; i<num_cuts; ++i) {
+    // same classes as DcoTreeNode::decide_using_cg()
+    int mask = (type_[i]==DcoConstraintTypeOA) ? 1 : 2;
+    if (!(type & mask)) {
+      continue;
+    }
+    double tolerance = isConicType(type_[i]) ? coneTol : integerTol;
+    double activity = 0.0;
+    for (int k=start[i]; k<start[i+1]; ++k) {
+      activity += value_[k]*sol[index_[k]];
+    }
+    double violation = CoinMax(lb_[i]-activity, activity-ub_[i]);
+    if (violation < tolerance) {
+      age_[i]++;
+      continue;
+    }
+    int size = start[i+1]-start[i];
+    DcoConstraint * con = new DcoLinearConstraint(size, &index_[start[i]],
+                                                  &value_[start[i]],
+                                                  lb_[i], ub_[i]);
+    con->setConstraintType(type_[i]);
+    conPool.addConstraint(con);
+    age_[i] = 0;
+    numUsed_[i]++;
+    num_sep++;
+  }
+  numSeparated_ += num_sep;
+  removeOld();
+  return num_sep;
+}
+
+void DcoCutPool::removeOld() {
+  int num_cuts = size();
+  int num_kept = 0;
+  int num_elem = 0;
+  for (int i=0; i<num_cuts; ++i) {
+    if (age_[i]>maxAge_) {
+      keys_.erase(key_[i]);
+      continue;
+    }
+    for (int k=start_[i]; k<start_[i+1]; ++k) {
+      index_[num_elem] = index_[k];
+      value_[num_elem] = value_[k];
+      num_elem++;
+    }
+    start_[num_kept+1] = num_elem;
+    lb_[num_kept] = lb_[i];
+    ub_[num_kept] = ub_[i];
+    type_[num_kept] = type_[i];
+    key_[num_kept] = key_[i];
+    age_[num_kept] = age_[i];
+    numUsed_[num_kept] = numUsed_[i];
+    num_kept++;
+  }
+  if (num_kept==num_cuts) {
+    return;
+  }
+  numRemoved_ += num_cuts-num_kept;
+  start_.resize(num_kept+1);
+  index_.resize(num_elem);
+  value_.resize(num_elem);
+  lb_.resize(num_kept);
+  ub_.resize(num_kept);
+  type_.resize(num_kept);
+  key_.resize(num_kept);
+  age_.resize(num_kept);
+  numUsed_.resize(num_kept);
+}
+
+void DcoCutPool::clear() {
+  start_.assign(1, 0);
+  index_.clear();
+  value_.clear();
+  lb_.clear();
+  ub_.clear();
+  type_.clear();
+  key_.clear();
+  keys_.clear();
+  age_.clear();
+  numUsed_.clear();
+}
@@ -0,0 +1,130 @@
+/*===========================================================================*
+ * This file is part of the Discrete Conic Optimization (DisCO) Solver.      *
+ *                                                                           *
+ * DisCO is distributed under the Eclipse Public License as part of the      *
+ * COIN-OR repository (http://www.coin-or.org).                              *
+ *                                                                           *
+ * Authors:                                                                  *
+ *          Aykut Bulut, Lehigh University                                   *
+ *          Yan Xu, Lehigh University                                        *
+ *          Ted Ralphs, Lehigh University                                    *
+ *                                                                           *
+ * Copyright (C) 2001-2018, Lehigh University, Aykut Bulut, Yan Xu, and      *
+ *                          Ted Ralphs.                                      *
+ * All Rights Reserved.                                                      *
+ *===========================================================================*/
+
+#ifndef DcoCutPool_hpp_
+#define DcoCutPool_hpp_
+
+#include <BcpsObjectPool.h>
+
+#include <set>
+#include <vector>
+
+#include "Dco.hpp"
+
+class DcoLinearConstraint;
+
+/*!
+  Pool of globally valid cuts shared by all nodes of the tree, i.e., OA
+  supports and MILP cuts that Cgl marks as globally valid. Cuts are stored
+  in a flat row-wise layout so that separation computes activities of all
+  cuts in one pass over the pool, only violated cuts are copied out.
+
+  Each cut has an age, number of calls to separate() since it was last
+  violated, and the number of times it was separated. Cuts older than the
+  maximum age are removed from the pool.
+*/
+
+class DcoCutPool {
+  ///@name Cut data
+  //@{
+  /// Start of each cut in index_ and value_, size is number of cuts + 1.
+  std::vector<int> start_;
+  /// Column indices of cut coefficients.
+  std::vector<int> index_;
+  /// Cut coefficients.
+  std::vector<double> value_;
+  /// Cut lower bounds.
+  std::vector<double> lb_;
+  /// Cut upper bounds.
+  std::vector<double> ub_;
+  /// Type of the generator of each cut.
+  std::vector<DcoConstraintType> type_;
+  /// Hash key of each cut, see DcoLinearConstraint::hashKey().
+  std::vector<std::size_t> key_;
+  /// Keys of the cuts in the pool.
+  std::set<std::size_t> keys_;
+  //@}
+
+  ///@name Age and activity
+  //@{
+  /// Number of separations since the cut was last violated.
+  std::vector<int> age_;
+  /// Number of times the cut was separated.
+  std::vector<int> numUsed_;
+  /// Cuts older than this are removed.
+  int maxAge_;
+  //@}
+
+  ///@name Statistics
+  //@{
+  /// Number of cuts added.
+  int numAdded_;
+  /// Number of cuts rejected since they are already in the pool.
+  int numDuplicate_;
+  /// Number of cuts separated from the pool.
+  int numSeparated_;
+  /// Number of cuts removed by aging.
+  int numRemoved_;
+  //@}
+
+  /// Remove cuts older than maximum age.
+  void removeOld();
+
+public:
+  ///@name Constructor and Destructor.
+  //@{
+  /// Constructor, creates an empty pool.
+  DcoCutPool();
+  /// Destructor.
+  ~DcoCutPool() {}
+  //@}
+
+  ///@name Pool operations
+  //@{
+  /// Set maximum age of cuts.
+  void setMaxAge(int maxAge) { maxAge_ = maxAge; }
+  /// Number of cuts in the pool.
+  int size() const { return static_cast<int>(lb_.size()); }
+  /// Add a copy of the cut to the pool unless it is already there. Returns
+  /// true if the cut is added.
+  bool addCut(DcoLinearConstraint const * con);
+  /// Add cuts selected by type that are violated at solution sol to
+  /// conPool. type is the bitmask of DcoTreeNode::generateConstraints(), 1
+  /// for OA cuts and 2 for the rest. Cuts of conic types are separated with
+  /// coneTol, MILP cuts with integerTol. Updates ages of the checked cuts
+  /// and removes old cuts. Returns number of cuts added.
+  int separate(double const * sol, int type, double coneTol,
+               double integerTol, BcpsConstraintPool & conPool);
+  /// Remove all cuts.
+  void clear();
+  //@}
+
+  ///@name Get statistics
+  //@{
+  int numAdded() const { return numAdded_; }
+  int numDuplicate() const { return numDuplicate_; }
+  int numSeparated() const { return numSeparated_; }
+  int numRemoved() const { return numRemoved_; }
+  //@}
+
+private:
+  /// Disable copy constructor.
+  DcoCutPool(DcoCutPool const & other);
+  /// Disable copy assignment operator.
+  DcoCutPool & operator=(DcoCutPool const & rhs);
+};
+
+#endif
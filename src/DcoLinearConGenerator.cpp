@@ -67,6 +67,10 @@ bool DcoLinearConGenerator::generateConstraints(BcpsConstraintPool & conPool) {
   // we can not handle probing yet.
   CglProbing * generator = dynamic_cast<CglProbing *>(generator_);
   if (generator) {
+    // generators may run concurrently.
+#ifdef _OPENMP
+#pragma omp critical (DcoMessage)
+#endif
     message_handler->message(3000, "Dco",
                              "Probing cut generator is not "
                              "implemented yet. Skipping cut "
@@ -77,13 +81,14 @@ bool DcoLinearConGenerator::generateConstraints(BcpsConstraintPool & conPool) {
   else {
     // need to refresh solver
     // store generator type in a class member (DcoLinearCutType)
-    generator_->refreshSolver(model()->solver());
-    generator_->generateCuts(*model()->solver(), new_cuts);
+    generator_->refreshSolver(solver());
+    generator_->generateCuts(*solver(), new_cuts);
   }
 
 
 
   // create disco constraints
+  bool share = model()->dcoPar()->entry(DcoParams::shareConstraints);
   int num_cuts = new_cuts.sizeRowCuts();
   for (int i=0; i<num_cuts; ++i) {
     OsiRowCut & rcut = new_cuts.rowCut(i);
@@ -94,15 +99,23 @@ bool DcoLinearConGenerator::generateConstraints(BcpsConstraintPool & conPool) {
     double ub = rcut.ub();
     if (len > 0) {
       // create DcoConstraints from OsiCuts.
-      DcoConstraint * con = new DcoLinearConstraint(len, ind, val, lb, ub);
+      DcoLinearConstraint * con =
+        new DcoLinearConstraint(len, ind, val, lb, ub);
       con->setConstraintType(type());
       conPool.addConstraint(con);
+      // globally valid cuts are shared with other nodes
+      if (share and rcut.globallyValid()) {
+        shareConstraint(con);
+      }
     }
     else if (len==0) {
       // Empty cuts
       std::stringstream msg;
       msg << "Skipping empty cut generated by "
           << name();
+#ifdef _OPENMP
+#pragma omp critical (DcoMessage)
+#endif
       message_handler->message(3000, "Dco", msg.str().c_str(), 'W', 0)
         << CoinMessageEol;
     }
@@ -110,6 +123,9 @@ bool DcoLinearConGenerator::generateConstraints(BcpsConstraintPool & conPool) {
       std::stringstream msg;
       msg << "Negative cut length given by "
           << name();
+#ifdef _OPENMP
+#pragma omp critical (DcoMessage)
+#endif
       message_handler->message(9998, "Dco", msg.str().c_str(), 'E', 0)
         << CoinMessageEol;
     }
@@ -20,6 +20,24 @@
 #include <CoinHelperFunctions.hpp>
 #include <OsiRowCut.hpp>
 
+#include <cstring>
+
+// FNV-1a hash step for a 64 bit word.
+static inline std::size_t hashStep(std::size_t hash, unsigned long long word) {
+  std::size_t const prime = static_cast<std::size_t>(1099511628211ULL);
+  for (int i=0; i<8; ++i) {
+    hash = (hash ^ static_cast<std::size_t>(word & 0xff)) * prime;
+    word >>= 8;
+  }
+  return hash;
+}
+
+static inline std::size_t hashStep(std::size_t hash, double value) {
+  unsigned long long word;
+  std::memcpy(&word, &value, sizeof(word));
+  return hashStep(hash, word);
+}
+
 DcoLinearConstraint::DcoLinearConstraint() {
   size_ = 0;
   indices_ = NULL;
@@ -104,6 +122,18 @@ OsiRowCut * DcoLinearConstraint::createOsiRowCut(DcoModel * model) const {
   return cut;
 }
 
+std::size_t DcoLinearConstraint::hashKey() const {
+  std::size_t hash = static_cast<std::size_t>(14695981039346656037ULL);
+  hash = hashStep(hash, static_cast<unsigned long long>(size_));
+  for (int i=0; i<size_; ++i) {
+    hash = hashStep(hash, static_cast<unsigned long long>(indices_[i]));
+    hash = hashStep(hash, values_[i]);
+  }
+  hash = hashStep(hash, CoinMax(getLbHard(), getLbSoft()));
+  hash = hashStep(hash, CoinMin(getUbHard(), getUbSoft()));
+  return hash ? hash : 1;
+}
+
 double DcoLinearConstraint::infeasibility(BcpsModel * m,
                                           int & preferredWay) const {
   std::cerr << "Not implemented!" << std::endl;
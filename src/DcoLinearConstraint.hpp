@@ -51,6 +51,9 @@ public:
   int const * getIndices() const;
   double const * getValues() const;
   virtual OsiRowCut * createOsiRowCut(DcoModel * model) const;
+  /// Hash of coefficients and bounds. Constraints with the same key are
+  /// considered the same row of the solver. Never 0.
+  std::size_t hashKey() const;
   virtual double infeasibility(BcpsModel * m, int & preferredWay) const;
 
   ///@name Encode and Decode functions
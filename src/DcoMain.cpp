@@ -19,6 +19,7 @@
 #include "DcoSolution.hpp"
 #include "DcoTreeNode.hpp"
 #include "DcoBranchObject.hpp"
+#include "DcoNodeSelectionPlunge.hpp"
 
 #if  COIN_HAS_MPI
 #include "AlpsKnowledgeBrokerMPI.h"
@@ -90,6 +91,10 @@ int main(int argc, char *argv[]) {
 #else
   AlpsKnowledgeBrokerSerial broker(argc, argv, model);
 #endif
+  // Plunge into children of branched nodes, broker owns the rule.
+  if (model.dcoPar()->entry(DcoParams::plungeChild)!=DcoPlungeChildNone) {
+    broker.setNodeSelection(new DcoNodeSelectionPlunge());
+  }
 
   // Search for best solution
   broker.search(&model);
@@ -128,6 +128,7 @@ static Dco_message us_english[]=
     // tree node
     {DISCO_NODE_BRANCHONINT, 9201, 1, "[%d] Branched on integer variable. Variable index %d."},
     {DISCO_NODE_UNEXPECTEDSTATUS,9202,1, "[%d] Unexpected node status %d"},
+    {DISCO_NODE_NOT_EXPLICIT, 9203, 1, "[%d] Node %d has no parent and no explicit description."},
     {DISCO_NODE_FATHOM_PARENTQ, 203, DISCO_DLOG_PROCESS,
      "[%d] Node %d fathomed due to parent quality, abs gap %f, relative gap %f."},
     {DISCO_NODE_FATHOM, 204, DISCO_DLOG_PROCESS,
@@ -138,6 +139,17 @@ static Dco_message us_english[]=
      "[%d] Branching node %d, variable %d, value %f, score %f."},
     {DISCO_NODE_ENCODED, 207, DISCO_DLOG_MPI, "[%d] Node %d encoded."},
     {DISCO_NODE_DECODED, 208, DISCO_DLOG_MPI, "[%d] Node decoded into %d."},
+    {DISCO_INSTALL_STATS_FINAL, 209, 1, "Installed %d subproblems, %d from an explicit node, changed %d column bounds, added %d rows, removed %d rows, relaxed %d rows, restored %d rows"},
+    {DISCO_INSTALL_PATH_STATS, 210, 1, "Install applied %.2f node descriptions on average, %d at most, distance to explicit node %.2f on average, %d at most"},
+    {DISCO_SNAPSHOT_STATS, 211, 1, "Stored %d full node descriptions as snapshots, %.1f KB"},
+    {DISCO_PLUNGE_STATS, 212, 1, "Started %d plunges, processed %d nodes in plunges, %d at most in a plunge, %d plunges stopped by gap"},
+    {DISCO_COMPACT_STATS, 213, 1, "Compacted explicit nodes %d times, converted %d nodes to relative, freed %.1f MB"},
+    {DISCO_ALLOC_STATS, 214, 1, "%s allocator served %.0f allocations, %.0f from free list, %d chunks, %.1f KB, at most %d in use"},
+    {DISCO_NODE_TIMING_STATS, 215, 1, "Phase %s: %d calls, wall %.3f s, cpu %.3f s, nodes by wall time (s)%s"},
+    {DISCO_CUT_POOL_STATS, 216, 1, "Global cut pool: %d cuts added, %d duplicates rejected, %d separated, %d removed by aging, %d left"},
+    {DISCO_ROOT_CACHE_LOADED, 217, 1, "Added %d of %d rows from root cache, %d cone approximation cuts, problem data match %d"},
+    {DISCO_ROOT_CACHE_SAVED, 218, 1, "Saved %d root rows to root cache, %d cone approximation cuts"},
+    {DISCO_ROOT_CACHE_FAILED, 9219, 1, "Unable to write root cache to directory %s"},
     // constraint generation
     {DISCO_INVALID_CUT_FREQUENCY,9301,1, "%d is not a valid cut frequency, changed it to %d."},
     {DISCO_INEFFECTIVE_CUT, 302, DISCO_DLOG_CUT, "[%d] Node %d, cut is ignored since the activity is low."},
@@ -150,6 +162,7 @@ static Dco_message us_english[]=
     {DISCO_SOLVER_INFEASIBLE, 404, DISCO_DLOG_PROCESS, "[%d] Node %d is infeasible. Status set to fathom."},
     {DISCO_FAILED_WARM_START, 9405, DISCO_DLOG_PROCESS, "[%d] Node %d, setting warm start failed."},
     {DISCO_SOLVER_ITERATIONS, 406, 1, "Total number of relaxation solver iterations %d"},
+    {DISCO_BASIS_STATS_FINAL, 407, 1, "Stored %d warm start bases for %d nodes, %.1f bytes per node, %.1f bytes per node as full copies, peak %.1f KB"},
     // heuristics
     {DISCO_HEUR_BEFORE_ROOT, 501, 4, "%s heuristic found a solution; quality is %g"},
     {DISCO_HEUR_STATS_FINAL, 502, 1, "Called %s heuristic %d times, found %d solutions, CPU time %.4f seconds, current strategy %d"},
@@ -159,9 +172,10 @@ static Dco_message us_english[]=
     {DISCO_HEUR_NOSOL_FOUND, 505, DISCO_DLOG_HEURISTIC, "[%d] %s heuristic is called and no solution is found."},
     // branch strategies
     {DISCO_PSEUDO_REPORT, 551, DISCO_DLOG_BRANCH, "[%d] Pseudocost score of variable %d is %f."},
-    {DISCO_PSEUDO_DUP, 552, DISCO_DLOG_BRANCH, "[%d] Updating down pseudocost of %d from %f to %f, frac value %f."},
-    {DISCO_PSEUDO_UUP, 553, DISCO_DLOG_BRANCH, "[%d] Updating up pseudocost of %d from %f to %f, frac value %f."},
+    {DISCO_PSEUDO_DUP, 552, DISCO_DLOG_BRANCH, "[%d] Updating down pseudocost of %d from %f to %f, observation %f."},
+    {DISCO_PSEUDO_UUP, 553, DISCO_DLOG_BRANCH, "[%d] Updating up pseudocost of %d from %f to %f, observation %f."},
     {DISCO_STRONG_REPORT, 554, DISCO_DLOG_BRANCH, "[%d] Strong score of variable %d is %f."},
+    {DISCO_REL_REPORT, 555, DISCO_DLOG_BRANCH, "[%d] Reliability score of variable %d is %f, strong branched %d."},
 
     // grumpy messages
     // time, node status, node id, parent id, branch direction, obj val [,sum
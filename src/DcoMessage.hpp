@@ -57,12 +57,24 @@ enum DISCO_Message {
     // tree node
     DISCO_NODE_BRANCHONINT,
     DISCO_NODE_UNEXPECTEDSTATUS,
+    DISCO_NODE_NOT_EXPLICIT,
     DISCO_NODE_FATHOM_PARENTQ,
     DISCO_NODE_FATHOM,
     DISCO_NODE_BCP_DECISION,
     DISCO_NODE_BRANCH,
     DISCO_NODE_ENCODED,
     DISCO_NODE_DECODED,
+    DISCO_INSTALL_STATS_FINAL,
+    DISCO_INSTALL_PATH_STATS,
+    DISCO_SNAPSHOT_STATS,
+    DISCO_PLUNGE_STATS,
+    DISCO_COMPACT_STATS,
+    DISCO_ALLOC_STATS,
+    DISCO_NODE_TIMING_STATS,
+    DISCO_CUT_POOL_STATS,
+    DISCO_ROOT_CACHE_LOADED,
+    DISCO_ROOT_CACHE_SAVED,
+    DISCO_ROOT_CACHE_FAILED,
     // constraint generation
     DISCO_INVALID_CUT_FREQUENCY,
     DISCO_INEFFECTIVE_CUT,
@@ -74,6 +86,7 @@ enum DISCO_Message {
     DISCO_SOLVER_INFEASIBLE,
     DISCO_FAILED_WARM_START,
     DISCO_SOLVER_ITERATIONS,
+    DISCO_BASIS_STATS_FINAL,
     // heuristics
     DISCO_HEUR_BEFORE_ROOT,
     DISCO_HEUR_STATS_FINAL,
@@ -86,6 +99,7 @@ enum DISCO_Message {
     DISCO_PSEUDO_DUP,
     DISCO_PSEUDO_UUP,
     DISCO_STRONG_REPORT,
+    DISCO_REL_REPORT,
     // grumpy messages
     DISCO_GRUMPY_MESSAGE_LONG,
     DISCO_GRUMPY_MESSAGE_MED,
@@ -17,6 +17,10 @@
 
 // CoinUtils
 #include <CoinMpsIO.hpp>
+#include <CoinTime.hpp>
+
+// Osi headers
+#include <OsiRowCut.hpp>
 
 // Disco headers
 #include "DcoModel.hpp"
@@ -28,6 +32,7 @@
 #include "DcoConicConstraint.hpp"
 #include "DcoBranchStrategyMaxInf.hpp"
 #include "DcoBranchStrategyPseudo.hpp"
+#include "DcoBranchStrategyRel.hpp"
 #include "DcoBranchStrategyStrong.hpp"
 #include "DcoConGenerator.hpp"
 #include "DcoLinearConGenerator.hpp"
@@ -37,6 +42,7 @@
 #include "DcoHeuristic.hpp"
 #include "DcoHeurRounding.hpp"
 #include "DcoCbfIO.hpp"
+#include "DcoWarmStart.hpp"
 
 // MILP cuts
 #include <CglCutGenerator.hpp>
@@ -63,7 +69,9 @@
 #include <sstream>
 #include <numeric>
 #include <cmath>
+#include <cstring>
 #include <iomanip>
+#include <algorithm>
 
 // ordering of conNames should match the ordering of DcoConstraintType enum
 // type.
@@ -116,17 +124,52 @@ DcoModel::DcoModel() {
   dcoPar_ = new DcoParams();
   numRelaxedCols_ = 0;
   relaxedCols_ = NULL;
+  integralityValid_ = false;
+  numInfRelaxed_ = 0;
+  maxRelaxedInfeas_ = 0.0;
+  conesValid_ = false;
+  numInfCones_ = 0;
+  maxConeInfeas_ = 0.0;
   numRelaxedRows_ = 0;
   relaxedRows_ = NULL;
+  rowIndexValid_ = false;
   dcoMessageHandler_ = new CoinMessageHandler();
   dcoMessages_ = new DcoMessage();
   // set branch strategy
   branchStrategy_ = NULL;
   rampUpBranchStrategy_ = NULL;
+  pcostShareNode_ = 0;
   // cut and heuristics objects will be set in setupSelf.
 
   initOAcuts_ = 0;
 
+  installedBaseDepth_ = 0;
+  installedColLB_ = NULL;
+  installedColUB_ = NULL;
+  syncAllCols_ = true;
+  numPoolFree_ = 0;
+  numInstalls_ = 0;
+  numFullInstalls_ = 0;
+  numInstallColChanges_ = 0;
+  numInstallRowsAdded_ = 0;
+  numInstallRowsRemoved_ = 0;
+  numInstallRowsRelaxed_ = 0;
+  numInstallRowsRestored_ = 0;
+  numInstallPathNodes_ = 0;
+  maxInstallPathNodes_ = 0;
+  totalDiffDepth_ = 0;
+  maxDiffDepth_ = 0;
+  numSnapshots_ = 0;
+  snapshotBytes_ = 0;
+  numPlunges_ = 0;
+  numPlungeNodes_ = 0;
+  maxPlungeDepth_ = 0;
+  numPlungeGapStops_ = 0;
+  explicitBytes_ = 0;
+  numCompactions_ = 0;
+  numCompactedNodes_ = 0;
+  compactedBytes_ = 0;
+
   dcoMessageHandler_->setPrefix(0);
   dcoMessageHandler_->message(DISCO_WELCOME, *dcoMessages_)
     << DISCO_VERSION
@@ -145,6 +188,14 @@ DcoModel::~DcoModel() {
     delete[] colUB_;
     colUB_=NULL;
   }
+  if (installedColLB_) {
+    delete[] installedColLB_;
+    installedColLB_=NULL;
+  }
+  if (installedColUB_) {
+    delete[] installedColUB_;
+    installedColUB_=NULL;
+  }
   if (rowLB_) {
     delete[] rowLB_;
     rowLB_=NULL;
@@ -284,6 +335,17 @@ void DcoModel::readInstance(char const * dataFile) {
     << numConicRows_
     << numIntegerCols_
     << CoinMessageEol;
+
+#ifdef __OA__
+  // rows cached by earlier runs are added by approximateCones().
+  std::string cache_dir = dcoPar_->entry(DcoParams::rootCacheDir);
+  if (numConicRows_ && !cache_dir.empty()) {
+    std::size_t structure_key = 0;
+    std::size_t data_key = 0;
+    instanceKeys(structure_key, data_key);
+    rootCache_.setup(cache_dir, structure_key, data_key);
+  }
+#endif
 }
 
 // this should go into OsiConicSolverInterface or CoinUtils?
@@ -561,6 +623,24 @@ void DcoModel::approximateCones() {
   int num_oa_cuts = 0;
   // solve problem
   solver_->resolve();
+  // add rows cached by an earlier run. Cone approximation cuts are valid
+  // for instances with the same structure, approximation continues from
+  // them. Root cuts and basis are added only if problem data match, then
+  // there is nothing left to approximate.
+  if (rootCache_.load()) {
+    int num_added = rootCache_.apply(solver_);
+    solver_->resolve();
+    dcoMessageHandler_->message(DISCO_ROOT_CACHE_LOADED, *dcoMessages_)
+      << num_added
+      << rootCache_.numRows()
+      << rootCache_.numConeCuts()
+      << static_cast<int>(rootCache_.dataMatch())
+      << CoinMessageEol;
+    if (rootCache_.dataMatch()) {
+      initOAcuts_ = solver_->getNumRows() - numLinearRows_;
+      return;
+    }
+  }
   // get cone data in the required form
   // todo(aykut) think about updating cut library for the input format
   OsiLorentzConeType * coneTypes = new OsiLorentzConeType[numConicRows_];
@@ -583,60 +663,113 @@ void DcoModel::approximateCones() {
   // used to decide on number of iterations in outer approximation
   int largest_cone_size = *std::max_element(coneSizes,
                                             coneSizes+numConicRows_);
+  double cone_tol = dcoPar_->entry(DcoParams::coneTol);
+  // generators are reused by all rounds.
+  CglConicCutGenerator * cg_ipm = new CglConicIPM();
   do {
     // generate cuts
-    OsiCuts * ipm_cuts = new OsiCuts();
-    OsiCuts * oa_cuts = new OsiCuts();
-    CglConicCutGenerator * cg_ipm = new CglConicIPM();
-    CglConicCutGenerator * cg_oa =
-      new CglConicOA(dcoPar_->entry(DcoParams::coneTol));
-    // get cone info
-    cg_ipm->generateCuts(*solver_, *ipm_cuts, numConicRows_, coneTypes,
+    OsiCuts ipm_cuts;
+    cg_ipm->generateCuts(*solver_, ipm_cuts, numConicRows_, coneTypes,
                          coneSizes, coneMembers, largest_cone_size);
-    // cg_oa->generateCuts(*solver_, *oa_cuts, numCoreCones_, coneTypes_,
-    //                   coneSizes_, coneMembers_, largest_cone_size);
     // if we do not get any cuts break the loop
-    if (ipm_cuts->sizeRowCuts()==0 && oa_cuts->sizeRowCuts()==0) {
+    if (ipm_cuts.sizeRowCuts()==0) {
       break;
     }
     // if problem is unbounded do nothing, add cuts to the problem
     // this will make lp relaxation infeasible
-    solver_->applyCuts(*ipm_cuts);
-    solver_->applyCuts(*oa_cuts);
+    solver_->applyCuts(ipm_cuts);
     solver_->resolve();
-    num_ipm_cuts += ipm_cuts->sizeRowCuts();
-    delete ipm_cuts;
-    delete oa_cuts;
-    delete cg_ipm;
-    delete cg_oa;
+    num_ipm_cuts += ipm_cuts.sizeRowCuts();
     dual_infeasible = solver_->isProvenDualInfeasible();
     iter++;
   } while(dual_infeasible);
-  // add outer approximating cuts for DcoParams::approxNumPass (default is 50)
-  // many rounds
+  delete cg_ipm;
+  // add outer approximating cuts for at most DcoParams::approxNumPass
+  // (default is 400) many rounds, only for the cones that are still
+  // violated. Stop when the bound improves slower than
+  // DcoParams::approxMinRate.
   ipm_iter = iter;
   iter = 0;
   int oa_iter_limit = dcoPar_->entry(DcoParams::approxNumPass);
+  double min_rate = dcoPar_->entry(DcoParams::approxMinRate);
+  int num_threads = 1;
+#ifdef _OPENMP
+  num_threads = CoinMax(1, dcoPar_->entry(DcoParams::cutGenThreads));
+#endif
+  // one OA generator and cut container for each thread.
+  std::vector<CglConicCutGenerator*> cg_oa(num_threads);
+  std::vector<OsiCuts> oa_cuts(num_threads);
+  for (int t=0; t<num_threads; ++t) {
+    cg_oa[t] = new CglConicOA(cone_tol);
+  }
+  // violated cones in the form the generator expects
+  std::vector<OsiLorentzConeType> inf_types(numConicRows_+1);
+  std::vector<int> inf_sizes(numConicRows_+1);
+  std::vector<int const *> inf_members(numConicRows_+1);
+  double last_obj = solver_->getObjValue();
   while(iter<oa_iter_limit) {
-    OsiCuts * oa_cuts = new OsiCuts();
-    CglConicCutGenerator * cg_oa =
-      new CglConicOA(dcoPar_->entry(DcoParams::coneTol));
-    cg_oa->generateCuts(*solver_, *oa_cuts, numConicRows_, coneTypes,
-                        coneSizes, coneMembers, 1);
-    int num_cuts = oa_cuts->sizeRowCuts();
+    double start_time = CoinGetTimeOfDay();
+    // collect violated cones, relaxed row i is cone i under OA.
+    invalidateCones();
+    checkConeFeasibility();
+    int num_inf = numInfCones();
+    for (int k=0; k<num_inf; ++k) {
+      int i = infCones_[k];
+      inf_types[k] = coneTypes[i];
+      inf_sizes[k] = coneSizes[i];
+      inf_members[k] = coneMembers[i];
+    }
+    if (num_inf==0) {
+      break;
+    }
+    // split violated cones among threads, tangents of each chunk are
+    // computed independently and merged in chunk order. Osi accessors may
+    // build caches lazily, each chunk reads its own snapshot of the solver.
+    int num_chunks = CoinMin(num_threads, num_inf);
+    std::vector<OsiSolverInterface*> snapshots(num_chunks, solver_);
+    for (int t=1; t<num_chunks; ++t) {
+      snapshots[t] = solver_->clone(true);
+    }
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static) num_threads(num_chunks)
+#endif
+    for (int t=0; t<num_chunks; ++t) {
+      int first = (num_inf*t)/num_chunks;
+      int last = (num_inf*(t+1))/num_chunks;
+      cg_oa[t]->generateCuts(*snapshots[t], oa_cuts[t], last-first,
+                             &inf_types[first], &inf_sizes[first],
+                             &inf_members[first], 1);
+    }
+    for (int t=1; t<num_chunks; ++t) {
+      delete snapshots[t];
+    }
+    int num_cuts = 0;
+    for (int t=0; t<num_chunks; ++t) {
+      num_cuts += oa_cuts[t].sizeRowCuts();
+      solver_->applyCuts(oa_cuts[t]);
+      oa_cuts[t] = OsiCuts();
+    }
     num_oa_cuts += num_cuts;
     if (num_cuts==0) {
-      // ifno cuts are produced break early
-      delete oa_cuts;
-      delete cg_oa;
+      // if no cuts are produced break early
       break;
     }
-    solver_->applyCuts(*oa_cuts);
     solver_->resolve();
-    delete oa_cuts;
-    delete cg_oa;
     iter++;
+    // stop if bound improves slowly
+    double obj = solver_->getObjValue();
+    double elapsed = CoinMax(CoinGetTimeOfDay() - start_time, 1e-6);
+    double rate = fabs(obj-last_obj)/CoinMax(1.0, fabs(obj))/elapsed;
+    last_obj = obj;
+    if (rate < min_rate) {
+      break;
+    }
+  }
+  for (int t=0; t<num_threads; ++t) {
+    delete cg_oa[t];
   }
+  // solution in solver changes below.
+  invalidateCones();
   oa_iter = iter;
   std::cout << "===== Preprocessing Summary =====" << std::endl;
   std::cout << "IPM iterations " << ipm_iter << std::endl;
@@ -723,6 +856,7 @@ void DcoModel::approximateCones() {
                   << " remain: " << numCuts-numDel
                   << std::endl;
         solver_->deleteRows(numDel, delInd);
+        invalidateRowIndex();
         // resolve to correct status
         solver_->resolve();
       }
@@ -765,6 +899,12 @@ bool DcoModel::setupSelf() {
   relaxedCols_ = new int[numRelaxedCols_];
   std::copy(integerCols_, integerCols_+numIntegerCols_,
             relaxedCols_);
+  // one more entry so that the arrays are never empty.
+  relaxedValue_.assign(numRelaxedCols_+1, 0.0);
+  relaxedInfeas_.assign(numRelaxedCols_+1, 0.0);
+  relaxedDir_.assign(numRelaxedCols_+1, 1);
+  infRelaxed_.assign(numRelaxedCols_+1, 0);
+  invalidateIntegrality();
   // set iteration count to 0
   numRelaxIterations_ = 0;
 #ifdef __OA__
@@ -832,6 +972,37 @@ bool DcoModel::setupSelf() {
   setupAddLinearConstraints();
   // create disco constraints, conic
   setupAddConicConstraints();
+  // split relaxed cones by type for checkConeFeasibility()
+  lorentzCones_.clear();
+  rotatedCones_.clear();
+  for (int i=0; i<numRelaxedRows_; ++i) {
+    if (coneType_[i]==1) {
+      lorentzCones_.push_back(i);
+    }
+    else {
+      rotatedCones_.push_back(i);
+    }
+  }
+  int num_members = numRelaxedRows_ ? coneStart_[numRelaxedRows_] : 0;
+  coneValue_.assign(num_members+1, 0.0);
+  coneInfeas_.assign(numRelaxedRows_+1, 0.0);
+  infCones_.assign(numRelaxedRows_+1, 0);
+  invalidateCones();
+  // index relaxed cones by their member columns
+  colConeStart_.assign(numCols_+1, 0);
+  for (int k=0; k<num_members; ++k) {
+    colConeStart_[coneMembers_[k]+1]++;
+  }
+  for (int j=0; j<numCols_; ++j) {
+    colConeStart_[j+1] += colConeStart_[j];
+  }
+  colCones_.assign(num_members+1, 0);
+  std::vector<int> col_pos(colConeStart_.begin(), colConeStart_.end()-1);
+  for (int i=0; i<numRelaxedRows_; ++i) {
+    for (int k=coneStart_[i]; k<coneStart_[i+1]; ++k) {
+      colCones_[col_pos[coneMembers_[k]]++] = i;
+    }
+  }
 
   // set branch strategy
   setBranchingStrategy();
@@ -849,9 +1020,743 @@ bool DcoModel::setupSelf() {
   if (cutoff!=ALPS_INC_MAX) {
     solver_->setDblParam(OsiDualObjectiveLimit, objSense_*cutoff);
   }
+
+  // nothing is installed in the solver yet.
+  if (installedColLB_) {
+    delete[] installedColLB_;
+  }
+  if (installedColUB_) {
+    delete[] installedColUB_;
+  }
+  installedColLB_ = new double[numCols_];
+  installedColUB_ = new double[numCols_];
+  clearInstalled();
+  poolKey_.clear();
+  poolActive_.clear();
+  poolRow_.clear();
+  numPoolFree_ = 0;
+  invalidateRowIndex();
+  rowScratch_.assign(numCols_, 0.0);
+  cutPool_.clear();
+  cutPool_.setMaxAge(dcoPar_->entry(DcoParams::cutPoolMaxAge));
+
+  // time node processing phases, each process writes its own file.
+  std::string timing_file = dcoPar_->entry(DcoParams::nodeTimingFile);
+  if (!timing_file.empty() &&
+      broker_->getProcType()!=AlpsProcessTypeSerial) {
+    std::stringstream rank;
+    rank << "." << broker_->getProcRank();
+    timing_file += rank.str();
+  }
+  nodeTimer_.setup(dcoPar_->entry(DcoParams::nodeTiming), timing_file);
   return true;
 }
 
+bool DcoModel::isInstalled(AlpsTreeNode const * node) const {
+  int pos = node->getDepth() - installedBaseDepth_;
+  if (pos<0 || pos>=static_cast<int>(installedPath_.size())) {
+    return false;
+  }
+  return installedPath_[pos]==node &&
+    installedPathIndex_[pos]==node->getIndex();
+}
+
+void DcoModel::clearInstalled() {
+  installedPath_.clear();
+  installedPathIndex_.clear();
+  installedBaseDepth_ = 0;
+  // explicit descriptions store the bounds that differ from the original
+  // problem.
+  CoinDisjointCopyN(colLB_, numCols_, installedColLB_);
+  CoinDisjointCopyN(colUB_, numCols_, installedColUB_);
+  boundTrailDepth_.clear();
+  boundTrailIndex_.clear();
+  boundTrailLB_.clear();
+  boundTrailUB_.clear();
+  touchedCols_.clear();
+  syncAllCols_ = true;
+  installedCons_.clear();
+  consTrailDepth_.clear();
+  consTrail_.clear();
+}
+
+void DcoModel::undoInstalled(int depth) {
+  // restore bounds changed by the nodes deeper than depth
+  while (!boundTrailDepth_.empty() && boundTrailDepth_.back()>depth) {
+    int index = boundTrailIndex_.back();
+    installedColLB_[index] = boundTrailLB_.back();
+    installedColUB_[index] = boundTrailUB_.back();
+    touchedCols_.push_back(index);
+    boundTrailDepth_.pop_back();
+    boundTrailIndex_.pop_back();
+    boundTrailLB_.pop_back();
+    boundTrailUB_.pop_back();
+  }
+  // restore constraint list
+  while (!consTrailDepth_.empty() && consTrailDepth_.back()>depth) {
+    installedCons_.swap(consTrail_.back());
+    consTrailDepth_.pop_back();
+    consTrail_.pop_back();
+  }
+  // remove nodes deeper than depth from path
+  int size = CoinMax(depth-installedBaseDepth_+1, 0);
+  if (size<static_cast<int>(installedPath_.size())) {
+    installedPath_.resize(size);
+    installedPathIndex_.resize(size);
+  }
+}
+
+void DcoModel::tightenInstalledBounds(int depth, int index, double lb,
+                                      double ub, bool record) {
+  double new_lb = CoinMax(installedColLB_[index], lb);
+  double new_ub = CoinMin(installedColUB_[index], ub);
+  if (new_lb==installedColLB_[index] && new_ub==installedColUB_[index]) {
+    return;
+  }
+  if (record) {
+    boundTrailDepth_.push_back(depth);
+    boundTrailIndex_.push_back(index);
+    boundTrailLB_.push_back(installedColLB_[index]);
+    boundTrailUB_.push_back(installedColUB_[index]);
+  }
+  installedColLB_[index] = new_lb;
+  installedColUB_[index] = new_ub;
+  touchedCols_.push_back(index);
+}
+
+void DcoModel::applyInstalled(AlpsTreeNode * node, bool base) {
+  DcoNodeDesc * desc = dynamic_cast<DcoNodeDesc*>(node->getDesc());
+  int depth = node->getDepth();
+  bool record = !base;
+  if (base) {
+    installedBaseDepth_ = depth;
+  }
+  //--------------------------------------------------
+  // Adjust bounds according to hard and soft var lb/ub.
+  // Hard bounds do NOT change according to soft bounds, so
+  // here we need CoinMax/CoinMin.
+  //--------------------------------------------------
+  BcpsObjectListMod * vars = desc->getVars();
+  for (int k=0; k<vars->lbHard.numModify; ++k) {
+    tightenInstalledBounds(depth, vars->lbHard.posModify[k],
+                           vars->lbHard.entries[k], ALPS_DBL_MAX, record);
+  }
+  for (int k=0; k<vars->ubHard.numModify; ++k) {
+    tightenInstalledBounds(depth, vars->ubHard.posModify[k],
+                           -ALPS_DBL_MAX, vars->ubHard.entries[k], record);
+  }
+  for (int k=0; k<vars->lbSoft.numModify; ++k) {
+    tightenInstalledBounds(depth, vars->lbSoft.posModify[k],
+                           vars->lbSoft.entries[k], ALPS_DBL_MAX, record);
+  }
+  for (int k=0; k<vars->ubSoft.numModify; ++k) {
+    tightenInstalledBounds(depth, vars->ubSoft.posModify[k],
+                           -ALPS_DBL_MAX, vars->ubSoft.entries[k], record);
+  }
+  //--------------------------------------------------
+  // TODO: Modify hard/soft row lb/ub.
+  //--------------------------------------------------
+  //--------------------------------------------------
+  // Collect active non-core constraints. First add generated cuts, then
+  // remove deleted ones. Positions of removed constraints are relative to
+  // the list after addition.
+  //--------------------------------------------------
+  BcpsObjectListMod * cons = desc->getCons();
+  if (cons->numAdd>0 || cons->numRemove>0) {
+    if (record) {
+      consTrailDepth_.push_back(depth);
+      consTrail_.push_back(installedCons_);
+    }
+    for (int k=0; k<cons->numAdd; ++k) {
+      installedCons_.push_back(dynamic_cast<DcoConstraint*>
+                               (cons->objects[k]));
+    }
+    if (cons->numRemove>0) {
+      int numOldCons = static_cast<int>(installedCons_.size());
+      std::vector<char> removed(numOldCons, 0);
+      for (int k=0; k<cons->numRemove; ++k) {
+        removed[cons->posRemove[k]] = 1;
+      }
+      int numSurvived = 0;
+      for (int k=0; k<numOldCons; ++k) {
+        if (!removed[k]) {
+          installedCons_[numSurvived++] = installedCons_[k];
+        }
+      }
+      assert(numSurvived+cons->numRemove==numOldCons);
+      installedCons_.resize(numSurvived);
+    }
+  }
+  installedPath_.push_back(node);
+  installedPathIndex_.push_back(node->getIndex());
+}
+
+void DcoModel::addInstallPath(int numNodes, int diffDepth) {
+  numInstallPathNodes_ += numNodes;
+  maxInstallPathNodes_ = CoinMax(maxInstallPathNodes_, numNodes);
+  totalDiffDepth_ += diffDepth;
+  maxDiffDepth_ = CoinMax(maxDiffDepth_, diffDepth);
+}
+
+void DcoModel::addExplicitNode(AlpsTreeNode * node, int bytes) {
+  std::map<AlpsTreeNode*, int>::iterator it = explicitNodes_.find(node);
+  if (it!=explicitNodes_.end()) {
+    explicitBytes_ -= it->second;
+    it->second = bytes;
+  }
+  else {
+    explicitNodes_[node] = bytes;
+  }
+  explicitBytes_ += bytes;
+}
+
+void DcoModel::removeExplicitNode(AlpsTreeNode * node) {
+  std::map<AlpsTreeNode*, int>::iterator it = explicitNodes_.find(node);
+  if (it!=explicitNodes_.end()) {
+    explicitBytes_ -= it->second;
+    explicitNodes_.erase(it);
+  }
+}
+
+void DcoModel::compactNodes(AlpsTreeNode * active) {
+  int limit = dcoPar_->entry(DcoParams::compactNodeMemory);
+  if (limit<=0 || explicitBytes_<=1048576LL*limit) {
+    return;
+  }
+  numCompactions_++;
+  long long int old_bytes = explicitBytes_;
+  // convertToRelative() unregisters the nodes it converts, iterate on a copy.
+  std::vector<AlpsTreeNode*> nodes;
+  nodes.reserve(explicitNodes_.size());
+  std::map<AlpsTreeNode*, int>::const_iterator it;
+  for (it=explicitNodes_.begin(); it!=explicitNodes_.end(); ++it) {
+    if (it->first!=active) {
+      nodes.push_back(it->first);
+    }
+  }
+  int num_explicit = static_cast<int>(explicitNodes_.size());
+  for (unsigned int i=0; i<nodes.size(); ++i) {
+    nodes[i]->convertToRelative();
+  }
+  numCompactedNodes_ += num_explicit - static_cast<int>(explicitNodes_.size());
+  compactedBytes_ += old_bytes - explicitBytes_;
+}
+
+void DcoModel::addPlungeNode(int depth) {
+  if (depth==1) {
+    numPlunges_++;
+  }
+  numPlungeNodes_++;
+  maxPlungeDepth_ = CoinMax(maxPlungeDepth_, depth);
+}
+
+void DcoModel::syncInstalled() {
+  numInstalls_++;
+  //--------------------------------------------------------
+  // Column bounds, change the ones that differ from the solver.
+  //--------------------------------------------------------
+  double const * solver_lb = solver_->getColLower();
+  double const * solver_ub = solver_->getColUpper();
+  std::vector<int> indices;
+  std::vector<double> bounds;
+  if (syncAllCols_) {
+    numFullInstalls_++;
+    for (int i=0; i<numCols_; ++i) {
+      if (installedColLB_[i]!=solver_lb[i] ||
+          installedColUB_[i]!=solver_ub[i]) {
+        indices.push_back(i);
+      }
+    }
+  }
+  else {
+    std::sort(touchedCols_.begin(), touchedCols_.end());
+    touchedCols_.erase(std::unique(touchedCols_.begin(), touchedCols_.end()),
+                       touchedCols_.end());
+    std::vector<int>::const_iterator it;
+    for (it=touchedCols_.begin(); it!=touchedCols_.end(); ++it) {
+      if (installedColLB_[*it]!=solver_lb[*it] ||
+          installedColUB_[*it]!=solver_ub[*it]) {
+        indices.push_back(*it);
+      }
+    }
+  }
+  int numChanged = static_cast<int>(indices.size());
+  if (numChanged) {
+    bounds.reserve(2*numChanged);
+    for (int k=0; k<numChanged; ++k) {
+      bounds.push_back(installedColLB_[indices[k]]);
+      bounds.push_back(installedColUB_[indices[k]]);
+    }
+    solver_->setColSetBounds(&indices[0], &indices[0]+numChanged,
+                             &bounds[0]);
+    numInstallColChanges_ += numChanged;
+  }
+  touchedCols_.clear();
+  syncAllCols_ = false;
+
+  //--------------------------------------------------------
+  // Rows, restore pool rows of the installed constraints and relax the rest.
+  // Only constraints that are not in the pool are added.
+  //--------------------------------------------------------
+  int base = numLinearRows_ + initOAcuts_;
+  int numPool = static_cast<int>(poolKey_.size());
+  // rows after the pool are not known to it, cuts are registered by
+  // addInstalledCons() when they are added.
+  int numExtra = solver_->getNumRows() - base - numPool;
+  if (numExtra>0) {
+#ifndef __COLA__
+    int * delInd = new int[numExtra];
+    for (int i=0; i<numExtra; ++i) {
+      delInd[i] = base + numPool + i;
+    }
+    solver_->deleteRows(numExtra, delInd);
+    invalidateRowIndex();
+    delete[] delInd;
+    numInstallRowsRemoved_ += numExtra;
+#else
+    // we do not delete rows from conic solvers, keep them as pinned rows.
+    poolKey_.insert(poolKey_.end(), numExtra, 0);
+    poolActive_.insert(poolActive_.end(), numExtra, 1);
+    numPool += numExtra;
+#endif
+  }
+  double infinity = solver_->getInfinity();
+  std::vector<int> rowIndices;
+  std::vector<double> rowBounds;
+  std::vector<DcoLinearConstraint*> newCons;
+  poolUsed_.assign(numPool, 0);
+  std::vector<DcoConstraint*>::const_iterator it;
+  for (it=installedCons_.begin(); it!=installedCons_.end(); ++it) {
+    DcoLinearConstraint * con = dynamic_cast<DcoLinearConstraint*>(*it);
+    if (con==NULL) {
+      continue;
+    }
+    std::size_t key = con->hashKey();
+    int row = -1;
+    std::pair<std::multimap<std::size_t, int>::const_iterator,
+              std::multimap<std::size_t, int>::const_iterator> range =
+      poolRow_.equal_range(key);
+    for (; range.first!=range.second; ++range.first) {
+      if (!poolUsed_[range.first->second]) {
+        row = range.first->second;
+        break;
+      }
+    }
+    if (row==-1) {
+      newCons.push_back(con);
+      continue;
+    }
+    poolUsed_[row] = 1;
+    if (!poolActive_[row]) {
+      rowIndices.push_back(base+row);
+      rowBounds.push_back(CoinMax(con->getLbHard(), con->getLbSoft()));
+      rowBounds.push_back(CoinMin(con->getUbHard(), con->getUbSoft()));
+      poolActive_[row] = 1;
+      numPoolFree_--;
+      numInstallRowsRestored_++;
+    }
+  }
+  for (int row=0; row<numPool; ++row) {
+    if (!poolUsed_[row] && poolActive_[row] && poolKey_[row]) {
+      rowIndices.push_back(base+row);
+      rowBounds.push_back(-infinity);
+      rowBounds.push_back(infinity);
+      poolActive_[row] = 0;
+      numPoolFree_++;
+      numInstallRowsRelaxed_++;
+    }
+  }
+  if (!rowIndices.empty()) {
+    solver_->setRowSetBounds(&rowIndices[0],
+                             &rowIndices[0]+rowIndices.size(),
+                             &rowBounds[0]);
+  }
+  int numAdd = static_cast<int>(newCons.size());
+  if (numAdd>0) {
+    OsiRowCut const ** cuts = new OsiRowCut const * [numAdd];
+    for (int k=0; k<numAdd; ++k) {
+      cuts[k] = newCons[k]->createOsiRowCut(this);
+      std::size_t key = newCons[k]->hashKey();
+      poolRow_.insert(std::make_pair(key, numPool+k));
+      poolKey_.push_back(key);
+      poolActive_.push_back(1);
+    }
+    solver_->applyRowCuts(numAdd, cuts);
+    for (int k=0; k<numAdd; ++k) {
+      delete cuts[k];
+    }
+    delete[] cuts;
+    numInstallRowsAdded_ += numAdd;
+    numPool += numAdd;
+  }
+#ifndef __COLA__
+  // too many relaxed rows make the relaxation slow, delete them.
+  if (numPoolFree_ > dcoPar_->entry(DcoParams::rowPoolMaxFree)) {
+    std::vector<char> removed(numPool, 0);
+    std::vector<int> delInd;
+    for (int row=0; row<numPool; ++row) {
+      if (!poolActive_[row]) {
+        removed[row] = 1;
+        delInd.push_back(base+row);
+      }
+    }
+    solver_->deleteRows(static_cast<int>(delInd.size()), &delInd[0]);
+    invalidateRowIndex();
+    numInstallRowsRemoved_ += static_cast<int>(delInd.size());
+    compactPool(removed);
+  }
+#endif
+}
+
+/// Return true if con is a linear constraint whose hash key is in sorted
+/// keys.
+static bool hasKey(DcoConstraint const * con,
+                   std::vector<std::size_t> const & keys) {
+  DcoLinearConstraint const * lcon =
+    dynamic_cast<DcoLinearConstraint const *>(con);
+  return lcon &&
+    std::binary_search(keys.begin(), keys.end(), lcon->hashKey());
+}
+
+bool DcoModel::isLastInstalled(AlpsTreeNode const * node) const {
+  return !installedPath_.empty() && installedPath_.back()==node &&
+    installedPathIndex_.back()==node->getIndex();
+}
+
+void DcoModel::recordInstalledCons() {
+  int depth = installedBaseDepth_ +
+    static_cast<int>(installedPath_.size()) - 1;
+  if (depth==installedBaseDepth_) {
+    // changes of the base node are not undone.
+    return;
+  }
+  if (consTrailDepth_.empty() || consTrailDepth_.back()!=depth) {
+    consTrailDepth_.push_back(depth);
+    consTrail_.push_back(installedCons_);
+  }
+}
+
+void DcoModel::addInstalledCons(int num, DcoConstraint * const * cons) {
+  if (num<=0 || installedPath_.empty()) {
+    return;
+  }
+  recordInstalledCons();
+  int base = numLinearRows_ + initOAcuts_;
+  int numPool = static_cast<int>(poolKey_.size());
+  int first = solver_->getNumRows() - num;
+  // rows between the pool and the new cuts are not known, pin them.
+  if (first-base>numPool) {
+    poolKey_.insert(poolKey_.end(), first-base-numPool, 0);
+    poolActive_.insert(poolActive_.end(), first-base-numPool, 1);
+    numPool = first - base;
+  }
+  for (int k=0; k<num; ++k) {
+    installedCons_.push_back(cons[k]);
+    DcoLinearConstraint * con = dynamic_cast<DcoLinearConstraint*>(cons[k]);
+    std::size_t key = con ? con->hashKey() : 0;
+    if (key) {
+      poolRow_.insert(std::make_pair(key, numPool+k));
+    }
+    poolKey_.push_back(key);
+    poolActive_.push_back(1);
+  }
+}
+
+void DcoModel::removeSolverRows(int num, int const * indices) {
+  int base = numLinearRows_ + initOAcuts_;
+  int numPool = static_cast<int>(poolKey_.size());
+  std::vector<char> removed(numPool, 0);
+  bool inPool = false;
+  std::vector<std::size_t> keys;
+  for (int k=0; k<num; ++k) {
+    int row = indices[k] - base;
+    if (row>=0 && row<numPool) {
+      removed[row] = 1;
+      inPool = true;
+      if (poolActive_[row] && poolKey_[row]) {
+        keys.push_back(poolKey_[row]);
+      }
+    }
+  }
+  if (!inPool) {
+    return;
+  }
+  compactPool(removed);
+  if (keys.empty() || installedPath_.empty()) {
+    return;
+  }
+  //--------------------------------------------------------
+  // Remove the constraints of deleted rows from the installed subproblem
+  // and from the description of the installed node. Positions in the
+  // description are relative to the list inherited from the parent
+  // followed by the constraints added by the node.
+  //--------------------------------------------------------
+  std::sort(keys.begin(), keys.end());
+  recordInstalledCons();
+  int numKept = 0;
+  int numInstalled = static_cast<int>(installedCons_.size());
+  for (int i=0; i<numInstalled; ++i) {
+    if (!hasKey(installedCons_[i], keys)) {
+      installedCons_[numKept++] = installedCons_[i];
+    }
+  }
+  installedCons_.resize(numKept);
+  AlpsTreeNode * node = installedPath_.back();
+  DcoNodeDesc * desc = dynamic_cast<DcoNodeDesc*>(node->getDesc());
+  BcpsObjectListMod * cons = desc->getCons();
+  // an explicit description stores its list in full, even if it was
+  // relative when installed.
+  std::vector<DcoConstraint*> inherited;
+  if (!node->getExplicit() && !consTrailDepth_.empty() &&
+      consTrailDepth_.back()==node->getDepth()) {
+    inherited = consTrail_.back();
+  }
+  int numInherited = static_cast<int>(inherited.size());
+  std::vector<int> positions;
+  for (int k=0; k<numInherited; ++k) {
+    if (hasKey(inherited[k], keys)) {
+      positions.push_back(k);
+    }
+  }
+  for (int k=0; k<cons->numAdd; ++k) {
+    if (hasKey(dynamic_cast<DcoConstraint*>(cons->objects[k]), keys)) {
+      positions.push_back(numInherited+k);
+    }
+  }
+  if (!positions.empty()) {
+    desc->removeCons(numInherited, static_cast<int>(positions.size()),
+                     &positions[0]);
+  }
+}
+
+void DcoModel::compactPool(std::vector<char> const & removed) {
+  int numPool = static_cast<int>(poolKey_.size());
+  int numSurvived = 0;
+  numPoolFree_ = 0;
+  poolRow_.clear();
+  for (int row=0; row<numPool; ++row) {
+    if (removed[row]) {
+      continue;
+    }
+    poolKey_[numSurvived] = poolKey_[row];
+    poolActive_[numSurvived] = poolActive_[row];
+    if (!poolActive_[numSurvived]) {
+      numPoolFree_++;
+    }
+    if (poolKey_[numSurvived]) {
+      poolRow_.insert(std::make_pair(poolKey_[numSurvived], numSurvived));
+    }
+    numSurvived++;
+  }
+  poolKey_.resize(numSurvived);
+  poolActive_.resize(numSurvived);
+}
+
+void DcoModel::adjustBasis(CoinWarmStartBasis * ws) const {
+  int numRows = solver_->getNumRows();
+  if (ws->getNumArtificial()!=numRows) {
+    ws->resize(numRows, solver_->getNumCols());
+  }
+  int base = numLinearRows_ + initOAcuts_;
+  int numPool = CoinMin(static_cast<int>(poolKey_.size()), numRows-base);
+  for (int row=0; row<numPool; ++row) {
+    if (!poolActive_[row]) {
+      ws->setArtifStatus(base+row, CoinWarmStartBasis::basic);
+    }
+  }
+}
+
+/// Mixes bits of x, finalizer of splitmix64. Sums of mixed words are used as
+/// hashes that do not depend on the order of row elements.
+static inline std::size_t mixHash(unsigned long long x) {
+  x ^= x >> 30;
+  x *= 0xbf58476d1ce4e5b9ULL;
+  x ^= x >> 27;
+  x *= 0x94d049bb133111ebULL;
+  x ^= x >> 31;
+  return static_cast<std::size_t>(x);
+}
+
+/// Hash of the sparsity pattern of a row.
+static std::size_t patternHash(int size, int const * indices) {
+  std::size_t hash = mixHash(static_cast<unsigned long long>(size));
+  for (int k=0; k<size; ++k) {
+    hash += mixHash(static_cast<unsigned long long>(indices[k]));
+  }
+  return hash;
+}
+
+/// Hash of the coefficients of a row scaled to unit norm and rounded to 6
+/// digits. Positive multiples of a row have the same fingerprint.
+static std::size_t fingerprint(int size, int const * indices,
+                               double const * values, double norm) {
+  std::size_t hash = 0;
+  for (int k=0; k<size; ++k) {
+    long long q = static_cast<long long>(floor(values[k]/norm*1.0e6 + 0.5));
+    unsigned long long word = static_cast<unsigned long long>(indices[k]);
+    hash += mixHash((word << 40) ^ static_cast<unsigned long long>(q));
+  }
+  return hash;
+}
+
+/// Hash of the bits of a double.
+static std::size_t doubleHash(double value) {
+  unsigned long long word = 0;
+  std::memcpy(&word, &value, sizeof(double));
+  return mixHash(word);
+}
+
+void DcoModel::instanceKeys(std::size_t & structureKey,
+                            std::size_t & dataKey) const {
+  // dimensions and sparsity pattern
+  structureKey = mixHash(static_cast<unsigned long long>(numCols_));
+  structureKey ^= mixHash(structureKey +
+                          static_cast<unsigned long long>(numLinearRows_));
+  structureKey ^= mixHash(structureKey +
+                          static_cast<unsigned long long>(numConicRows_));
+  structureKey ^= mixHash(structureKey + matrix_->isColOrdered());
+  dataKey = 0;
+  for (int i=0; i<matrix_->getMajorDim(); ++i) {
+    CoinShallowPackedVector vec = matrix_->getVector(i);
+    int size = vec.getNumElements();
+    std::size_t pattern = patternHash(size, vec.getIndices());
+    structureKey ^= mixHash(pattern + static_cast<unsigned long long>(i));
+    std::size_t values = mixHash(static_cast<unsigned long long>(i));
+    for (int k=0; k<size; ++k) {
+      values = mixHash(values ^ doubleHash(vec.getElements()[k]));
+    }
+    dataKey += values;
+  }
+  // integrality
+  for (int i=0; i<numIntegerCols_; ++i) {
+    structureKey ^= mixHash(static_cast<unsigned long long>(integerCols_[i])
+                            << 32);
+  }
+  // cones, order of members matter.
+  for (int i=0; i<numConicRows_; ++i) {
+    std::size_t cone = mixHash(static_cast<unsigned long long>(coneType_[i]));
+    for (int k=coneStart_[i]; k<coneStart_[i+1]; ++k) {
+      cone = mixHash(cone ^ static_cast<unsigned long long>(coneMembers_[k]));
+    }
+    structureKey += cone;
+  }
+  // bounds and objective
+  for (int i=0; i<numCols_; ++i) {
+    dataKey = mixHash(dataKey ^ doubleHash(colLB_[i]));
+    dataKey = mixHash(dataKey ^ doubleHash(colUB_[i]));
+    dataKey = mixHash(dataKey ^ doubleHash(objCoef_[i]));
+  }
+  for (int i=0; i<numLinearRows_; ++i) {
+    dataKey = mixHash(dataKey ^ doubleHash(rowLB_[i]));
+    dataKey = mixHash(dataKey ^ doubleHash(rowUB_[i]));
+  }
+  dataKey = mixHash(dataKey ^ structureKey);
+}
+
+void DcoModel::saveRootCache() {
+  if (!rootCache_.enabled() || rootCache_.dataMatch()) {
+    return;
+  }
+  if (rootCache_.save(solver_, numLinearRows_, initOAcuts_)) {
+    dcoMessageHandler_->message(DISCO_ROOT_CACHE_SAVED, *dcoMessages_)
+      << solver_->getNumRows() - numLinearRows_
+      << initOAcuts_
+      << CoinMessageEol;
+  }
+  else {
+    dcoMessageHandler_->message(DISCO_ROOT_CACHE_FAILED, *dcoMessages_)
+      << dcoPar_->entry(DcoParams::rootCacheDir).c_str()
+      << CoinMessageEol;
+  }
+}
+
+int DcoModel::parallelRow(int size, int const * indices,
+                          double const * values,
+                          double & cosine, double & scale) {
+  cosine = 0.0;
+  scale = 0.0;
+  //--------------------------------------------------------
+  // Index rows added to the solver since the last call.
+  //--------------------------------------------------------
+  CoinPackedMatrix const * mat = solver_->getMatrixByRow();
+  int num_rows = solver_->getNumRows();
+  if (!rowIndexValid_ || static_cast<int>(rowNorm_.size())>num_rows) {
+    rowPattern_.clear();
+    rowFinger_.clear();
+    rowNorm_.clear();
+    rowIndexValid_ = true;
+  }
+  for (int k=static_cast<int>(rowNorm_.size()); k<num_rows; ++k) {
+    int first = mat->getVectorFirst(k);
+    int row_size = mat->getVectorLast(k) - first;
+    int const * ind = mat->getIndices() + first;
+    double const * val = mat->getElements() + first;
+    double norm = sqrt(std::inner_product(val, val+row_size, val, 0.0));
+    rowNorm_.push_back(norm);
+    rowFinger_.push_back(norm>0.0 ? fingerprint(row_size, ind, val, norm) : 0);
+    if (norm>0.0) {
+      rowPattern_.insert(std::make_pair(patternHash(row_size, ind), k));
+    }
+  }
+  double cut_norm = sqrt(std::inner_product(values, values+size, values,
+                                            0.0));
+  if (size<=0 || cut_norm==0.0) {
+    return -1;
+  }
+  //--------------------------------------------------------
+  // Compare with the rows of the same pattern. A row with the same
+  // fingerprint is a duplicate, it is checked first.
+  //--------------------------------------------------------
+  std::pair<std::multimap<std::size_t, int>::const_iterator,
+            std::multimap<std::size_t, int>::const_iterator> range =
+    rowPattern_.equal_range(patternHash(size, indices));
+  if (range.first==range.second) {
+    return -1;
+  }
+  std::size_t finger = fingerprint(size, indices, values, cut_norm);
+  double const * lb = solver_->getRowLower();
+  double const * ub = solver_->getRowUpper();
+  double infinity = solver_->getInfinity();
+  double * dense = &rowScratch_[0];
+  for (int k=0; k<size; ++k) {
+    dense[indices[k]] = values[k];
+  }
+  int best = -1;
+  std::multimap<std::size_t, int>::const_iterator it;
+  for (it=range.first; it!=range.second; ++it) {
+    int row = it->second;
+    if (lb[row]<=-infinity && ub[row]>=infinity) {
+      continue;
+    }
+    int first = mat->getVectorFirst(row);
+    int row_size = mat->getVectorLast(row) - first;
+    if (row_size!=size) {
+      continue;
+    }
+    int const * ind = mat->getIndices() + first;
+    double const * val = mat->getElements() + first;
+    double inn_prod = 0.0;
+    for (int j=0; j<row_size; ++j) {
+      inn_prod += val[j]*dense[ind[j]];
+    }
+    inn_prod = inn_prod/(cut_norm*rowNorm_[row]);
+    if (best==-1 || inn_prod>cosine) {
+      best = row;
+      cosine = inn_prod;
+    }
+    if (rowFinger_[row]==finger && inn_prod>0.0) {
+      break;
+    }
+  }
+  for (int k=0; k<size; ++k) {
+    dense[indices[k]] = 0.0;
+  }
+  if (best!=-1) {
+    scale = rowNorm_[best]/cut_norm;
+  }
+  return best;
+}
+
 // set message level
 void DcoModel::setMessageLevel() {
   // get Alps log level
@@ -1299,6 +2204,7 @@ void DcoModel::addHeuristics() {
 }
 
 void DcoModel::setBranchingStrategy() {
+  int reliability = dcoPar_->entry(DcoParams::pseudoReliability);
     // set branching startegy
   int brStrategy = static_cast<DcoBranchingStrategy>
     (dcoPar_->entry(DcoParams::branchStrategy));
@@ -1309,9 +2215,9 @@ void DcoModel::setBranchingStrategy() {
   case DcoBranchingStrategyPseudoCost:
     branchStrategy_ = new DcoBranchStrategyPseudo(this);
     break;
-  // case DcoBranchingStrategyReliability:
-  //   branchStrategy_ = new DcoBranchStrategyRel(this, reliability);
-  //   break;
+  case DcoBranchingStrategyReliability:
+    branchStrategy_ = new DcoBranchStrategyRel(this, reliability);
+    break;
   case DcoBranchingStrategyStrong:
      branchStrategy_ = new DcoBranchStrategyStrong(this);
      break;
@@ -1334,9 +2240,9 @@ void DcoModel::setBranchingStrategy() {
   case DcoBranchingStrategyPseudoCost:
     rampUpBranchStrategy_ = new DcoBranchStrategyPseudo(this);
     break;
-  // case DcoBranchingStrategyReliability:
-  //   rampUpBranchStrategy_ = new DcoBranchStrategyRel(this, reliability);
-  //   break;
+  case DcoBranchingStrategyReliability:
+    rampUpBranchStrategy_ = new DcoBranchStrategyRel(this, reliability);
+    break;
   case DcoBranchingStrategyStrong:
      rampUpBranchStrategy_ = new DcoBranchStrategyStrong(this);
      break;
@@ -1419,6 +2325,115 @@ AlpsTreeNode * DcoModel::createRoot() {
 }
 
 
+void DcoModel::checkIntegrality() {
+  if (integralityValid_) {
+    return;
+  }
+  int const num = numRelaxedCols_;
+  double const tolerance = dcoPar_->entry(DcoParams::integerTol);
+  double const * sol = solver_->getColSolution();
+  int const * cols = relaxedCols_;
+  double * value = &relaxedValue_[0];
+  double * infeas = &relaxedInfeas_[0];
+  int * dir = &relaxedDir_[0];
+  // gather values, so that the loop below works on contiguous arrays.
+  for (int i=0; i<num; ++i) {
+    value[i] = sol[cols[i]];
+  }
+  // branch free, compilers vectorize this loop. Same as
+  // DcoVariable::infeasibility().
+  for (int i=0; i<num; ++i) {
+    double dist_to_lower = value[i] - floor(value[i]);
+    double dist_to_upper = ceil(value[i]) - value[i];
+    bool down = dist_to_upper>dist_to_lower;
+    double dist = down ? dist_to_lower : dist_to_upper;
+    dir[i] = down ? -1 : 1;
+    infeas[i] = dist<tolerance ? 0.0 : dist;
+  }
+  // collect infeasible ones.
+  int * inf = &infRelaxed_[0];
+  int num_inf = 0;
+  double max_infeas = 0.0;
+  for (int i=0; i<num; ++i) {
+    inf[num_inf] = i;
+    num_inf += (infeas[i]!=0.0);
+    max_infeas = CoinMax(max_infeas, infeas[i]);
+  }
+  numInfRelaxed_ = num_inf;
+  maxRelaxedInfeas_ = max_infeas;
+  integralityValid_ = true;
+}
+
+/// Sum of squares of x[0], ..., x[n-1]. Four partial sums let compilers
+/// vectorize the loop without reassociating floating point additions.
+static double sumSquares(double const * x, int n) {
+  double s0 = 0.0, s1 = 0.0, s2 = 0.0, s3 = 0.0;
+  int i = 0;
+  for (; i+3<n; i+=4) {
+    s0 += x[i]*x[i];
+    s1 += x[i+1]*x[i+1];
+    s2 += x[i+2]*x[i+2];
+    s3 += x[i+3]*x[i+3];
+  }
+  for (; i<n; ++i) {
+    s0 += x[i]*x[i];
+  }
+  return (s0+s1) + (s2+s3);
+}
+
+void DcoModel::checkConeFeasibility() {
+  if (conesValid_) {
+    return;
+  }
+  int const num = numRelaxedRows_;
+  double const tolerance = dcoPar_->entry(DcoParams::coneTol);
+  double const * sol = solver_->getColSolution();
+  double * value = &coneValue_[0];
+  double * infeas = &coneInfeas_[0];
+  // gather members of all cones in one pass.
+  int const num_members = num ? coneStart_[num] : 0;
+  for (int k=0; k<num_members; ++k) {
+    value[k] = sol[coneMembers_[k]];
+  }
+  // Lorentz cones, |x_2n| - x_1
+  int const num_lorentz = lorentzCones_.size();
+  for (int k=0; k<num_lorentz; ++k) {
+    int i = lorentzCones_[k];
+    double const * x = value + coneStart_[i];
+    int size = coneStart_[i+1] - coneStart_[i];
+    infeas[i] = sqrt(sumSquares(x+1, size-1)) - x[0];
+  }
+  // rotated Lorentz cones, |x_3n|^2 - 2x_1x_2
+  int const num_rotated = rotatedCones_.size();
+  for (int k=0; k<num_rotated; ++k) {
+    int i = rotatedCones_[k];
+    double const * x = value + coneStart_[i];
+    int size = coneStart_[i+1] - coneStart_[i];
+    infeas[i] = sumSquares(x+2, size-2) - 2.0*x[0]*x[1];
+  }
+  // apply tolerance and collect violated ones.
+  int * inf = &infCones_[0];
+  int num_inf = 0;
+  double max_infeas = 0.0;
+  for (int i=0; i<num; ++i) {
+    infeas[i] = infeas[i]<=tolerance ? 0.0 : infeas[i];
+    inf[num_inf] = i;
+    num_inf += (infeas[i]!=0.0);
+    max_infeas = CoinMax(max_infeas, infeas[i]);
+  }
+  numInfCones_ = num_inf;
+  maxConeInfeas_ = max_infeas;
+  conesValid_ = true;
+}
+
+double DcoModel::coneParticipation(int col) const {
+  double sum = 0.0;
+  for (int k=colConeStart_[col]; k<colConeStart_[col+1]; ++k) {
+    sum += coneInfeas_[colCones_[k]];
+  }
+  return sum;
+}
+
 DcoSolution * DcoModel::feasibleSolution(int & numInfColumns,
                                          double  & colInf,
                                          int & numInfRows,
@@ -1432,38 +2447,16 @@ DcoSolution * DcoModel::feasibleSolution(int & numInfColumns,
   rowInf = 0.0;
 
   // check feasibility of relxed columns, ie. integrality constraints
-  // get vector of variables
-  std::vector<BcpsVariable*> & cols = getVariables();
-  for (int i=0; i<numRelaxedCols_; ++i) {
-    // get column relaxedCol_[i]
-    DcoVariable * curr = dynamic_cast<DcoVariable*> (cols[relaxedCols_[i]]);
-    // check feasibility
-    int preferredDir;
-    double infeas = curr->infeasibility(this, preferredDir);
-    if (infeas>0) {
-      numInfColumns++;
-      if (colInf<infeas) {
-        colInf = infeas;
-      }
-    }
-  }
-
-  // check feasibility of relaxed rows
-  // get vector of constraints
-  std::vector<BcpsConstraint*> & rows = getConstraints();
-  for (int i=0; i<numRelaxedRows_; ++i) {
-    // get row relaxedRows_[i]
-    DcoConstraint * curr = dynamic_cast<DcoConstraint*> (rows[relaxedRows_[i]]);
-    // check feasibility
-    int preferredDir;
-    double infeas = curr->infeasibility(this, preferredDir);
-    if (infeas>0) {
-      numInfRows++;
-      if (rowInf<infeas) {
-        rowInf = infeas;
-      }
-    }
-  }
+  invalidateIntegrality();
+  checkIntegrality();
+  numInfColumns = numInfRelaxed_;
+  colInf = maxRelaxedInfeas_;
+
+  // check feasibility of relaxed rows, ie. conic constraints
+  invalidateCones();
+  checkConeFeasibility();
+  numInfRows = numInfCones_;
+  rowInf = maxConeInfeas_;
   // report largest column and row infeasibilities
   dcoMessageHandler_->message(DISCO_INFEAS_REPORT, *dcoMessages_)
     << broker()->getProcRank()
@@ -1605,6 +2598,106 @@ void DcoModel::modelLog() {
           << CoinMessageEol;
       }
     }
+    // report warm start storage statistics
+    if (DcoWarmStart::numShared()) {
+      double num_nodes = static_cast<double>(DcoWarmStart::numShared());
+      dcoMessageHandler_->message(DISCO_BASIS_STATS_FINAL, *dcoMessages_)
+        << DcoWarmStart::numStored()
+        << DcoWarmStart::numShared()
+        << static_cast<double>(DcoWarmStart::storedBytes())/num_nodes
+        << static_cast<double>(DcoWarmStart::fullBytes())/num_nodes
+        << static_cast<double>(DcoWarmStart::peakBytes())/1024.0
+        << CoinMessageEol;
+    }
+    // report allocator statistics
+    DcoSlabAllocator const * allocators[] = {&DcoTreeNode::allocator(),
+                                             &DcoNodeDesc::allocator(),
+                                             &DcoWarmStart::allocator()};
+    for (int k=0; k<3; ++k) {
+      if (allocators[k]->numAlloc()) {
+        dcoMessageHandler_->message(DISCO_ALLOC_STATS, *dcoMessages_)
+          << allocators[k]->name()
+          << static_cast<double>(allocators[k]->numAlloc())
+          << static_cast<double>(allocators[k]->numReuse())
+          << allocators[k]->numChunks()
+          << static_cast<double>(allocators[k]->chunkBytes())/1024.0
+          << allocators[k]->peakLive()
+          << CoinMessageEol;
+      }
+    }
+    // report global cut pool
+    if (cutPool_.numAdded()) {
+      dcoMessageHandler_->message(DISCO_CUT_POOL_STATS, *dcoMessages_)
+        << cutPool_.numAdded()
+        << cutPool_.numDuplicate()
+        << cutPool_.numSeparated()
+        << cutPool_.numRemoved()
+        << cutPool_.size()
+        << CoinMessageEol;
+    }
+    // report node processing phase times
+    nodeTimer_.finish();
+    if (nodeTimer_.numNodes()) {
+      for (int k=0; k<DcoNodePhaseNum; ++k) {
+        if (nodeTimer_.calls(k)==0) {
+          continue;
+        }
+        std::stringstream hist;
+        for (int b=0; b<DcoNodeTimer::numBins; ++b) {
+          if (b<DcoNodeTimer::numBins-1) {
+            hist << " <" << DcoNodeTimer::binLimit(b) << ":";
+          }
+          else {
+            hist << " >=" << DcoNodeTimer::binLimit(b-1) << ":";
+          }
+          hist << nodeTimer_.histogram(k, b);
+        }
+        dcoMessageHandler_->message(DISCO_NODE_TIMING_STATS, *dcoMessages_)
+          << DcoNodeTimer::phaseName(k)
+          << nodeTimer_.calls(k)
+          << nodeTimer_.wall(k)
+          << nodeTimer_.cpu(k)
+          << hist.str().c_str()
+          << CoinMessageEol;
+      }
+    }
+    // report subproblem install statistics
+    dcoMessageHandler_->message(DISCO_INSTALL_STATS_FINAL, *dcoMessages_)
+      << numInstalls_
+      << numFullInstalls_
+      << numInstallColChanges_
+      << numInstallRowsAdded_
+      << numInstallRowsRemoved_
+      << numInstallRowsRelaxed_
+      << numInstallRowsRestored_
+      << CoinMessageEol;
+    if (numInstalls_) {
+      dcoMessageHandler_->message(DISCO_INSTALL_PATH_STATS, *dcoMessages_)
+        << static_cast<double>(numInstallPathNodes_)/numInstalls_
+        << maxInstallPathNodes_
+        << static_cast<double>(totalDiffDepth_)/numInstalls_
+        << maxDiffDepth_
+        << CoinMessageEol;
+    }
+    dcoMessageHandler_->message(DISCO_SNAPSHOT_STATS, *dcoMessages_)
+      << numSnapshots_
+      << static_cast<double>(snapshotBytes_)/1024.0
+      << CoinMessageEol;
+    if (numCompactions_) {
+      dcoMessageHandler_->message(DISCO_COMPACT_STATS, *dcoMessages_)
+        << numCompactions_
+        << numCompactedNodes_
+        << static_cast<double>(compactedBytes_)/1048576.0
+        << CoinMessageEol;
+    }
+    if (dcoPar_->entry(DcoParams::plungeChild)!=DcoPlungeChildNone) {
+      dcoMessageHandler_->message(DISCO_PLUNGE_STATS, *dcoMessages_)
+        << numPlunges_
+        << numPlungeNodes_
+        << maxPlungeDepth_
+        << numPlungeGapStops_
+        << CoinMessageEol;
+    }
     // report heuristic statistics
     for (unsigned int k=0; k<heuristics_.size(); ++k) {
       if (heuristics(k)->stats().numCalls() > 0) {
@@ -1890,6 +2983,52 @@ AlpsReturnStatus DcoModel::decodeToSelf(AlpsEncoded & encoded) {
   return status;
 }
 
+AlpsEncoded * DcoModel::packSharedKnowlege() {
+  DcoBranchStrategyPseudo * pseudo =
+    dynamic_cast<DcoBranchStrategyPseudo*>(branchStrategy_);
+  if (pseudo==NULL or pseudo->numShared()==0) {
+    return NULL;
+  }
+  bool share = false;
+  AlpsPhase phase = broker_->getPhase();
+  if (phase==AlpsPhaseRampup) {
+    share = dcoPar_->entry(DcoParams::sharePseudocostRampUp);
+  }
+  else if (phase==AlpsPhaseSearch) {
+    int frequency = dcoPar_->entry(DcoParams::sharePcostFrequency);
+    share = dcoPar_->entry(DcoParams::sharePseudocostSearch) and
+      broker_->getNumNodesProcessed()-pcostShareNode_>=frequency;
+  }
+  if (!share) {
+    return NULL;
+  }
+  pcostShareNode_ = broker_->getNumNodesProcessed();
+  int num_shared = pseudo->numShared();
+  AlpsEncoded * encoded = new AlpsEncoded(AlpsKnowledgeTypeModelGen);
+  pseudo->packShared(encoded);
+
+  // debug stuff
+  std::stringstream debug_msg;
+  debug_msg << "Proc[" << broker_->getProcRank() << "]"
+            << " shares pseudocosts of " << num_shared << " columns."
+            << std::endl;
+  dcoMessageHandler_->message(0, "Dco", debug_msg.str().c_str(),
+                              'G', DISCO_DLOG_MPI)
+    << CoinMessageEol;
+  // end of debug stuff
+
+  return encoded;
+}
+
+void DcoModel::unpackSharedKnowledge(AlpsEncoded & encoded) {
+  DcoBranchStrategyPseudo * pseudo =
+    dynamic_cast<DcoBranchStrategyPseudo*>(branchStrategy_);
+  if (pseudo==NULL) {
+    return;
+  }
+  pseudo->unpackShared(encoded);
+}
+
 void DcoModel::addNumRelaxIterations() {
   numRelaxIterations_ += solver_->getIterationCount();
 }
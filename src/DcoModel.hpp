@@ -26,6 +26,9 @@
 
 #include "DcoParams.hpp"
 #include "DcoConstraint.hpp"
+#include "DcoNodeTimer.hpp"
+#include "DcoCutPool.hpp"
+#include "DcoRootCache.hpp"
 
 class DcoConGenerator;
 class DcoSolution;
@@ -33,6 +36,7 @@ class DcoHeuristic;
 
 class CglCutGenerator;
 class CglConicCutGenerator;
+class CoinWarmStartBasis;
 
 /**
    Represents a discrete conic optimization problem (master problem).
@@ -105,12 +109,9 @@ class DcoModel: public BcpsModel {
   ///==========================================================================
   ///@name Variable and constraint bounds.
   //@{
-  // colLB_ and colUB_ used when installing subproblems in
-  // each node. Having it a class member we do not need to allocate and delete
-  // memory every time a subproblem is installed to the solver in a node.
-  /// Column lower bound, corresponds to the last subproblem installed.
+  /// Column lower bound.
   double * colLB_;
-  /// Column upper bound, corresponds to the last subproblem installed.
+  /// Column upper bound.
   double * colUB_;
   /// Row lower bound.
   double * rowLB_;
@@ -168,6 +169,8 @@ class DcoModel: public BcpsModel {
   BcpsBranchStrategy * branchStrategy_;
   /// Ramp up branch strategy.
   BcpsBranchStrategy * rampUpBranchStrategy_;
+  /// Number of nodes processed when pseudocosts were last shared in search.
+  int pcostShareNode_;
   //@}
 
   ///@name Dco parameters.
@@ -188,6 +191,55 @@ class DcoModel: public BcpsModel {
   int * relaxedRows_;
   //@}
 
+  ///@name Integrality of relaxed columns
+  /// Computed once for a solution by checkIntegrality(), shared by
+  /// feasibleSolution() and branch strategies. Arrays are indexed by
+  /// position in relaxedCols_.
+  //@{
+  /// True if the arrays below are computed for the solution in solver.
+  bool integralityValid_;
+  /// Solution values of relaxed columns.
+  std::vector<double> relaxedValue_;
+  /// Distance to closest integer, 0 if it is within integerTol.
+  std::vector<double> relaxedInfeas_;
+  /// Preferred branching direction, -1 down, 1 up.
+  std::vector<int> relaxedDir_;
+  /// Positions of infeasible relaxed columns, first numInfRelaxed_ are
+  /// used.
+  std::vector<int> infRelaxed_;
+  /// Number of infeasible relaxed columns.
+  int numInfRelaxed_;
+  /// Largest infeasibility.
+  double maxRelaxedInfeas_;
+  //@}
+
+  ///@name Feasibility of relaxed cones
+  /// Computed once for a solution by checkConeFeasibility() directly from
+  /// the flat cone layout (coneStart_, coneMembers_, coneType_). Relaxed row
+  /// i is cone i, arrays below are indexed by cone.
+  //@{
+  /// True if the arrays below are computed for the solution in solver.
+  bool conesValid_;
+  /// Indices of Lorentz cones.
+  std::vector<int> lorentzCones_;
+  /// Indices of rotated Lorentz cones.
+  std::vector<int> rotatedCones_;
+  /// Solution values of cone members, in coneMembers_ order.
+  std::vector<double> coneValue_;
+  /// Violation of cones, 0 if it is within coneTol.
+  std::vector<double> coneInfeas_;
+  /// Indices of violated cones, first numInfCones_ are used.
+  std::vector<int> infCones_;
+  /// Number of violated cones.
+  int numInfCones_;
+  /// Largest cone violation.
+  double maxConeInfeas_;
+  /// Relaxed cones each column is a member of, colCones_[colConeStart_[j]]
+  /// to colCones_[colConeStart_[j+1]-1] for column j. Built in setupSelf().
+  std::vector<int> colConeStart_;
+  std::vector<int> colCones_;
+  //@}
+
   ///@name Heuristics
   //@{
   DcoHeurStrategy heurStrategy_;
@@ -215,6 +267,143 @@ class DcoModel: public BcpsModel {
 
   /// Number of relaxation iterations.
   long long int numRelaxIterations_;
+
+  ///@name Installed subproblem
+  /// The subproblem loaded into the solver is remembered, so the next node
+  /// installs only its difference from it. Bound and constraint changes of
+  /// the nodes below the base node are recorded in trails, changes of nodes
+  /// that are not ancestors of the next node are undone using them.
+  //@{
+  /// Nodes of the installed path, from the base node to the last installed
+  /// node. Entry i is at depth #installedBaseDepth_ + i.
+  std::vector<AlpsTreeNode*> installedPath_;
+  /// Indices of the nodes in #installedPath_. Guards against addresses of
+  /// deleted nodes being reused.
+  std::vector<int> installedPathIndex_;
+  /// Depth of the base node, i.e., first node of #installedPath_.
+  int installedBaseDepth_;
+  /// Column lower bounds of the installed subproblem.
+  double * installedColLB_;
+  /// Column upper bounds of the installed subproblem.
+  double * installedColUB_;
+  /// Bound trail, depth of the node that changed the bound.
+  std::vector<int> boundTrailDepth_;
+  /// Bound trail, column index.
+  std::vector<int> boundTrailIndex_;
+  /// Bound trail, column lower bound before the change.
+  std::vector<double> boundTrailLB_;
+  /// Bound trail, column upper bound before the change.
+  std::vector<double> boundTrailUB_;
+  /// Columns with bounds changed since last sync with the solver.
+  std::vector<int> touchedCols_;
+  /// True if all column bounds should be synced with the solver.
+  bool syncAllCols_;
+  /// Non-core constraints of the installed subproblem.
+  std::vector<DcoConstraint*> installedCons_;
+  /// Constraint trail, depth of the node that changed the constraint list.
+  std::vector<int> consTrailDepth_;
+  /// Constraint trail, constraint list before the change.
+  std::vector<std::vector<DcoConstraint*> > consTrail_;
+  //@}
+
+  ///@name Solver row pool
+  /// Non-core constraints stay in solver rows when the nodes using them are
+  /// left. Rows not used by the installed subproblem are relaxed to free
+  /// rows, and restored when a node using them is installed. Pool rows come
+  /// after core rows and the cuts added by #approximateCones().
+  //@{
+  /// Key of each pool row, see DcoLinearConstraint::hashKey(). Rows with key
+  /// 0 are pinned, they are never relaxed.
+  std::vector<std::size_t> poolKey_;
+  /// 1 if pool row has the bounds of its constraint, 0 if it is relaxed.
+  std::vector<char> poolActive_;
+  /// Pool row positions by key.
+  std::multimap<std::size_t, int> poolRow_;
+  /// Number of relaxed rows in the pool.
+  int numPoolFree_;
+  /// Marks pool rows used by the installed subproblem, reused by installs.
+  std::vector<char> poolUsed_;
+  //@}
+
+  /// Globally valid cuts shared by all nodes, used when shareConstraints is
+  /// set.
+  DcoCutPool cutPool_;
+
+  /// Root rows and basis cached on disk, used when rootCacheDir is set.
+  DcoRootCache rootCache_;
+
+  ///@name Solver row fingerprints
+  /// Solver rows indexed by the hash of their sparsity pattern, used to
+  /// find duplicate and parallel cuts without scanning all rows. New rows
+  /// are indexed lazily, deleting rows invalidates the index.
+  //@{
+  /// False if the index should be rebuilt.
+  bool rowIndexValid_;
+  /// Rows with the same sparsity pattern, by pattern hash.
+  std::multimap<std::size_t, int> rowPattern_;
+  /// Hash of the quantized normalized coefficients of each row.
+  std::vector<std::size_t> rowFinger_;
+  /// Euclidean norm of each row.
+  std::vector<double> rowNorm_;
+  /// Dense workspace for cut coefficients, all zero between calls.
+  std::vector<double> rowScratch_;
+  //@}
+
+  ///@name Explicit nodes
+  /// Explicit nodes that have a parent, ie. the ones that can be converted
+  /// back to relative when memory is short.
+  //@{
+  /// Size of bound arrays of each explicit node.
+  std::map<AlpsTreeNode*, int> explicitNodes_;
+  /// Total size of bound arrays of explicit nodes.
+  long long int explicitBytes_;
+  //@}
+
+  ///@name Install statistics
+  //@{
+  /// Number of subproblems installed.
+  int numInstalls_;
+  /// Number of subproblems installed starting from an explicit node.
+  int numFullInstalls_;
+  /// Number of column bounds changed in solver by installs.
+  int numInstallColChanges_;
+  /// Number of rows added to solver by installs.
+  int numInstallRowsAdded_;
+  /// Number of rows removed from solver by installs.
+  int numInstallRowsRemoved_;
+  /// Number of pool rows relaxed by installs.
+  int numInstallRowsRelaxed_;
+  /// Number of relaxed pool rows restored by installs.
+  int numInstallRowsRestored_;
+  /// Total number of node descriptions applied by installs.
+  long long int numInstallPathNodes_;
+  /// Maximum number of node descriptions applied by an install.
+  int maxInstallPathNodes_;
+  /// Total distance of installed nodes to their closest explicit ancestor.
+  long long int totalDiffDepth_;
+  /// Maximum distance of an installed node to its closest explicit ancestor.
+  int maxDiffDepth_;
+  /// Number of full node descriptions stored by snapshots.
+  int numSnapshots_;
+  /// Bytes of full node descriptions stored by snapshots.
+  long long int snapshotBytes_;
+  /// Number of plunges started.
+  int numPlunges_;
+  /// Number of nodes processed in plunges.
+  int numPlungeNodes_;
+  /// Maximum number of nodes processed in a plunge.
+  int maxPlungeDepth_;
+  /// Number of plunges stopped since the gap to the best node was large.
+  int numPlungeGapStops_;
+  /// Number of times explicit nodes are compacted.
+  int numCompactions_;
+  /// Number of explicit nodes converted to relative by compaction.
+  int numCompactedNodes_;
+  /// Bytes of bound arrays freed by compaction.
+  long long int compactedBytes_;
+  /// Times of node processing phases.
+  DcoNodeTimer nodeTimer_;
+  //@}
   ///==========================================================================
 
 
@@ -241,6 +430,20 @@ class DcoModel: public BcpsModel {
   void addHeuristics();
   //@}
 
+  ///@name Install Helpers
+  //@{
+  /// Tighten installed bounds of column index. Records the old bounds into
+  /// the trail if record is true.
+  void tightenInstalledBounds(int depth, int index, double lb, double ub,
+                              bool record);
+  /// Record the constraint list of the last installed node into the trail
+  /// before it is changed, unless it is the base node or already recorded.
+  void recordInstalledCons();
+  /// Remove pool rows marked in removed (size of pool) from pool records.
+  /// Rows should be deleted from solver already.
+  void compactPool(std::vector<char> const & removed);
+  //@}
+
   /// write parameters to oustream
   void writeParameters(std::ostream& outstream) const;
 
@@ -334,6 +537,36 @@ public:
   int numRelaxedCols() const {return numRelaxedCols_;}
   /// Get array of indices to relaxed columns.
   int const * relaxedCols() const {return relaxedCols_;}
+  /// Compute integrality of relaxed columns for the solution in solver, if
+  /// it is not computed yet.
+  void checkIntegrality();
+  /// Solution in solver changed, integrality should be computed again.
+  void invalidateIntegrality() { integralityValid_ = false; }
+  /// Infeasibility of relaxed columns, see checkIntegrality().
+  double const * relaxedInfeas() const { return &relaxedInfeas_[0]; }
+  /// Preferred directions of relaxed columns, see checkIntegrality().
+  int const * relaxedDir() const { return &relaxedDir_[0]; }
+  /// Number of infeasible relaxed columns, see checkIntegrality().
+  int numInfRelaxed() const { return numInfRelaxed_; }
+  /// Positions of infeasible relaxed columns in relaxedCols(), see
+  /// checkIntegrality().
+  int const * infRelaxed() const { return &infRelaxed_[0]; }
+  /// Compute violations of relaxed cones for the solution in solver, if it
+  /// is not computed yet.
+  void checkConeFeasibility();
+  /// Solution in solver changed, cone violations should be computed again.
+  void invalidateCones() { conesValid_ = false; }
+  /// Violation of relaxed cones, see checkConeFeasibility().
+  double const * coneInfeas() const { return &coneInfeas_[0]; }
+  /// Number of violated cones, see checkConeFeasibility().
+  int numInfCones() const { return numInfCones_; }
+  /// Indices of violated cones, see checkConeFeasibility().
+  int const * infCones() const { return &infCones_[0]; }
+  /// Largest cone violation, see checkConeFeasibility().
+  double maxConeInfeas() const { return maxConeInfeas_; }
+  /// Sum of violations of relaxed cones column col is a member of, see
+  /// checkConeFeasibility().
+  double coneParticipation(int col) const;
   /// Get number of relaxed rows
   int numRelaxedRows() const {return numRelaxedRows_;}
   /// Get array of indices to relaxed rows.
@@ -378,6 +611,86 @@ public:
   //@}
 
 
+  ///@name Subproblem installation
+  //@{
+  /// Return true if node is on the path installed in the solver.
+  bool isInstalled(AlpsTreeNode const * node) const;
+  /// Forget the installed path. Next node description applied will be the
+  /// base of the installed path.
+  void clearInstalled();
+  /// Undo changes of installed nodes deeper than depth.
+  void undoInstalled(int depth);
+  /// Apply node description on top of the installed subproblem. Description
+  /// of a base node should be full, its changes are not recorded.
+  void applyInstalled(AlpsTreeNode * node, bool base);
+  /// Push the bounds and constraints changed since the last call to the
+  /// solver. Pool rows of the installed constraints are restored, other
+  /// pool rows are relaxed and only constraints missing from the pool are
+  /// added.
+  void syncInstalled();
+  /// Return true if node is the last node installed in the solver.
+  bool isLastInstalled(AlpsTreeNode const * node) const;
+  /// Constraints in the last num solver rows, added by the node being
+  /// processed, i.e., the last installed node. They become part of the
+  /// installed subproblem and of the pool. Description of the node should
+  /// own them.
+  void addInstalledCons(int num, DcoConstraint * const * cons);
+  /// Notify that solver rows are deleted outside of installation, i.e.,
+  /// inactive cuts are purged. Indices are solver row indices before
+  /// deletion, in ascending order. Deleted constraints of the installed
+  /// subproblem are removed from the description of the last installed
+  /// node.
+  void removeSolverRows(int num, int const * indices);
+  /// Fit a basis stored in a node description to the solver rows. Rows
+  /// added after the basis was stored and relaxed pool rows are basic.
+  void adjustBasis(CoinWarmStartBasis * ws) const;
+  /// Solver rows are deleted, row fingerprints should be rebuilt.
+  void invalidateRowIndex() { rowIndexValid_ = false; }
+  /// Find the solver row with the same sparsity pattern as the given cut
+  /// that makes the smallest angle with it. Returns -1 if there is none.
+  /// Otherwise, cosine is set to the cosine of the angle and scale to the
+  /// ratio of row and cut norms. Rows relaxed to free rows are skipped.
+  int parallelRow(int size, int const * indices, double const * values,
+                  double & cosine, double & scale);
+  /// Hash keys of the instance. Structure key depends on dimensions,
+  /// sparsity pattern, integrality and cones, data key on all problem data.
+  void instanceKeys(std::size_t & structureKey, std::size_t & dataKey) const;
+  /// Save root rows and basis to the root cache. No-op if the cache is not
+  /// used or the rows are already loaded from the cache.
+  void saveRootCache();
+  /// Column lower bounds of the installed subproblem.
+  double const * installedColLB() const { return installedColLB_; }
+  /// Column upper bounds of the installed subproblem.
+  double const * installedColUB() const { return installedColUB_; }
+  /// Record number of node descriptions applied by an install and the
+  /// distance of the installed node to its closest explicit ancestor.
+  void addInstallPath(int numNodes, int diffDepth);
+  /// Record a full node description stored by a snapshot.
+  void addSnapshot(int bytes) { numSnapshots_++; snapshotBytes_ += bytes; }
+  /// Record a node selected for plunging, depth is its position in the
+  /// plunge starting from 1.
+  void addPlungeNode(int depth);
+  /// Record a plunge stopped since the gap to the best node was large.
+  void addPlungeGapStop() { numPlungeGapStops_++; }
+  /// Timer of node processing phases.
+  DcoNodeTimer & nodeTimer() { return nodeTimer_; }
+  /// Global cut pool.
+  DcoCutPool & cutPool() { return cutPool_; }
+  //@}
+
+  ///@name Explicit node compaction
+  //@{
+  /// Register a node made explicit by convertToExplicit(), it can be
+  /// converted back to relative. bytes is size of its bound arrays.
+  /// Snapshots are not registered.
+  void addExplicitNode(AlpsTreeNode * node, int bytes);
+  /// Unregister an explicit node, no-op if node is not registered.
+  void removeExplicitNode(AlpsTreeNode * node);
+  /// Convert registered explicit nodes other than active to relative if
+  /// their memory exceeds parameter compactNodeMemory.
+  void compactNodes(AlpsTreeNode * active);
+  //@}
+
   /// Check feasiblity of subproblem solution, store number of infeasible
   /// columns and rows.
   virtual DcoSolution * feasibleSolution(int & numInfColumns, double & colInf,
@@ -397,12 +710,12 @@ public:
   /// Do necessary work to make model ready for use, such as classify
   /// variable and constraint types.
   /// Called from AlpsKnowledgeBrokerSerial::initializeSearch. Called
-  /// after readParameters and preprocess.
+  /// after readParameters and before preprocess.
   virtual bool setupSelf();
-  /// Preprocessing the model. Default does nothing. We do not have any
-  /// preprocessing for now.
+  /// Preprocessing the model. Approximates cones with outer approximation
+  /// cuts when built with OA, does nothing otherwise.
   /// Called from AlpsKnowledgeBrokerSerial::initializeSearch. Called
-  /// after readParameters and before setupSelf.
+  /// after setupSelf, relies on the cone layout it sets up.
   virtual void preprocess();
   /// Postprocessing the model. Default does nothing. We do not have any
   /// postprocessing for now.
@@ -440,6 +753,17 @@ public:
   virtual AlpsReturnStatus decodeToSelf(AlpsEncoded & encoded);
   //@}
 
+  ///@name Sharing knowledge with other processes
+  //@{
+  /// Called by the broker. Packs the pseudocost observations recorded since
+  /// the last call when sharePseudocostRampUp or sharePseudocostSearch
+  /// allow it. Returns NULL if there is nothing to share.
+  virtual AlpsEncoded * packSharedKnowlege();
+  /// Called by the broker. Merges the pseudocost observations packed by
+  /// another process into the branch strategy.
+  virtual void unpackSharedKnowledge(AlpsEncoded & encoded);
+  //@}
+
   /// report feasibility of the best solution
   void reportFeasibility();
 
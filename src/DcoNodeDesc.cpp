@@ -17,6 +17,25 @@
 
 #include "DcoNodeDesc.hpp"
 #include "DcoMessage.hpp"
+#include "DcoLinearConstraint.hpp"
+
+#include <algorithm>
+
+// node descriptions are created and deleted one at a time for each node.
+static DcoSlabAllocator descAllocator("Node description",
+                                      sizeof(DcoNodeDesc), 1024);
+
+void * DcoNodeDesc::operator new(std::size_t size) {
+  return descAllocator.allocate(size);
+}
+
+void DcoNodeDesc::operator delete(void * ptr, std::size_t size) {
+  descAllocator.deallocate(ptr, size);
+}
+
+DcoSlabAllocator const & DcoNodeDesc::allocator() {
+  return descAllocator;
+}
 
 DcoNodeDesc::DcoNodeDesc() {
   // set if as down branch by default
@@ -25,6 +44,8 @@ DcoNodeDesc::DcoNodeDesc() {
   // set to 0.0 by default.
   branchedVal_ = 0.0;
   basis_ = NULL;
+  diffDepth_ = 0;
+  diffBytes_ = 0;
 }
 
 DcoNodeDesc::DcoNodeDesc(DcoModel * model): BcpsNodeDesc(model) {
@@ -34,12 +55,12 @@ DcoNodeDesc::DcoNodeDesc(DcoModel * model): BcpsNodeDesc(model) {
   // set to 0.0 by default.
   branchedVal_ = 0.0;
   basis_ = NULL;
+  diffDepth_ = 0;
+  diffBytes_ = 0;
 }
 
 DcoNodeDesc::~DcoNodeDesc() {
-  if (basis_) {
-    delete basis_;
-  }
+  DcoWarmStart::release(basis_);
 }
 
 DcoNodeBranchDir DcoNodeDesc::getBranchedDir() const {
@@ -67,17 +88,126 @@ void DcoNodeDesc::setBranchedVal(double val) {
   branchedVal_ = val;
 }
 
-void DcoNodeDesc::setBasis(CoinWarmStartBasis *& ws) {
-  if (basis_) {
-    delete basis_;
+void DcoNodeDesc::setBasis(CoinWarmStartBasis *& ws, int maxChainLength) {
+  DcoWarmStart * parent = basis_;
+  basis_ = NULL;
+  if (ws) {
+    basis_ = new DcoWarmStart(ws, parent, maxChainLength);
+    DcoWarmStart::addShare(basis_);
+    delete ws;
+    ws = NULL;
+  }
+  DcoWarmStart::release(parent);
+}
+
+void DcoNodeDesc::shareBasis(DcoWarmStart * ws) {
+  if (ws) {
+    ws->addRef();
+    DcoWarmStart::addShare(ws);
+  }
+  DcoWarmStart::release(basis_);
+  basis_ = ws;
+}
+
+/** Create warm start basis. */
+CoinWarmStartBasis * DcoNodeDesc::createBasis() const {
+  if (basis_==NULL) {
+    return NULL;
+  }
+  return basis_->createBasis();
+}
+
+int DcoNodeDesc::boundBytes() const {
+  BcpsObjectListMod const * vars = getVars();
+  int numModify = vars->lbHard.numModify + vars->ubHard.numModify +
+    vars->lbSoft.numModify + vars->ubSoft.numModify;
+  return numModify*static_cast<int>(sizeof(int)+sizeof(double));
+}
+
+void DcoNodeDesc::appendCons(int num, BcpsObject * const * cons) {
+  if (num<=0) {
+    return;
   }
-  basis_= ws;
-  ws = NULL;
+  BcpsObjectListMod * mod = getCons();
+  BcpsObject ** objects = new BcpsObject*[mod->numAdd+num];
+  std::copy(mod->objects, mod->objects+mod->numAdd, objects);
+  std::copy(cons, cons+num, objects+mod->numAdd);
+  delete[] mod->objects;
+  mod->objects = objects;
+  mod->numAdd += num;
 }
 
-/** Get warm start basis. */
-CoinWarmStartBasis * DcoNodeDesc::getBasis() const {
-  return basis_;
+void DcoNodeDesc::removeCons(int numInherited, int num, int const * pos) {
+  if (num<=0) {
+    return;
+  }
+  BcpsObjectListMod * mod = getCons();
+  std::vector<char> own_removed(mod->numAdd, 0);
+  std::vector<int> inherited_removed(mod->posRemove,
+                                     mod->posRemove+mod->numRemove);
+  for (int k=0; k<num; ++k) {
+    if (pos[k]>=numInherited) {
+      own_removed[pos[k]-numInherited] = 1;
+    }
+    else {
+      inherited_removed.push_back(pos[k]);
+    }
+  }
+  // own constraints, keep the order of the survivors.
+  int num_kept = 0;
+  for (int k=0; k<mod->numAdd; ++k) {
+    if (own_removed[k]) {
+      delete mod->objects[k];
+    }
+    else {
+      mod->objects[num_kept++] = mod->objects[k];
+    }
+  }
+  mod->numAdd = num_kept;
+  // inherited constraints
+  std::sort(inherited_removed.begin(), inherited_removed.end());
+  inherited_removed.erase(std::unique(inherited_removed.begin(),
+                                      inherited_removed.end()),
+                          inherited_removed.end());
+  int num_remove = static_cast<int>(inherited_removed.size());
+  if (num_remove!=mod->numRemove) {
+    delete[] mod->posRemove;
+    mod->posRemove = new int[num_remove];
+    std::copy(inherited_removed.begin(), inherited_removed.end(),
+              mod->posRemove);
+    mod->numRemove = num_remove;
+  }
+}
+
+void DcoNodeDesc::makeConsExplicit(std::vector<DcoConstraint*> const &
+                                   inherited) {
+  BcpsObjectListMod * mod = getCons();
+  int num_inherited = static_cast<int>(inherited.size());
+  std::vector<char> removed(num_inherited, 0);
+  for (int k=0; k<mod->numRemove; ++k) {
+    removed[mod->posRemove[k]] = 1;
+  }
+  // same order as DcoModel::applyInstalled(), positions stored by the
+  // descendants stay valid.
+  std::vector<BcpsObject*> objects;
+  for (int k=0; k<num_inherited; ++k) {
+    if (!removed[k]) {
+      DcoLinearConstraint const * con =
+        dynamic_cast<DcoLinearConstraint const *>(inherited[k]);
+      assert(con);
+      objects.push_back(new DcoLinearConstraint(*con));
+    }
+  }
+  objects.insert(objects.end(), mod->objects, mod->objects+mod->numAdd);
+  delete[] mod->objects;
+  mod->objects = NULL;
+  mod->numAdd = 0;
+  delete[] mod->posRemove;
+  mod->posRemove = NULL;
+  mod->numRemove = 0;
+  if (!objects.empty()) {
+    appendCons(static_cast<int>(objects.size()), &objects[0]);
+  }
 }
 
 /// Encode this to an AlpsEncoded object.
@@ -99,21 +229,25 @@ AlpsReturnStatus DcoNodeDesc::encode(AlpsEncoded * encoded) const {
   encoded->writeRep(branchedDir_);
   encoded->writeRep(branchedInd_);
   encoded->writeRep(branchedVal_);
-  // Encode basis if available
+  encoded->writeRep(diffDepth_);
+  encoded->writeRep(diffBytes_);
+  // Encode basis if available, in full since the parent basis is not sent.
   int available = 0;
-  if (basis_) {
+  CoinWarmStartBasis * basis = createBasis();
+  if (basis) {
     available = 1;
     encoded->writeRep(available);
-    int numCols = basis_->getNumStructural();
-    int numRows = basis_->getNumArtificial();
+    int numCols = basis->getNumStructural();
+    int numRows = basis->getNumArtificial();
     encoded->writeRep(numCols);
     encoded->writeRep(numRows);
     // Pack structural.
-    int nint = (basis_->getNumStructural() + 15) >> 4;
-    encoded->writeRep(basis_->getStructuralStatus(), nint * 4);
+    int nint = (basis->getNumStructural() + 15) >> 4;
+    encoded->writeRep(basis->getStructuralStatus(), nint * 4);
     // Pack artificial.
-    nint = (basis_->getNumArtificial() + 15) >> 4;
-    encoded->writeRep(basis_->getArtificialStatus(), nint * 4);
+    nint = (basis->getNumArtificial() + 15) >> 4;
+    encoded->writeRep(basis->getArtificialStatus(), nint * 4);
+    delete basis;
   }
   else {
     encoded->writeRep(available);
@@ -150,13 +284,13 @@ AlpsReturnStatus DcoNodeDesc::decodeToSelf(AlpsEncoded & encoded) {
   encoded.readRep(branchedDir_);
   encoded.readRep(branchedInd_);
   encoded.readRep(branchedVal_);
+  encoded.readRep(diffDepth_);
+  encoded.readRep(diffBytes_);
   // decode basis if available
   int available;
   encoded.readRep(available);
+  DcoWarmStart::release(basis_);
   if (available==1) {
-    if (basis_) {
-      delete basis_;
-    }
     int numCols;
     int numRows;
     encoded.readRep(numCols);
@@ -172,18 +306,17 @@ AlpsReturnStatus DcoNodeDesc::decodeToSelf(AlpsEncoded & encoded) {
     char * artificialStatus = new char[4 * nint];
     encoded.readRep(artificialStatus, tempInt);
     assert(tempInt == nint*4);
-    basis_ = new CoinWarmStartBasis();
-    if (!basis_) {
+    CoinWarmStartBasis * basis = new CoinWarmStartBasis();
+    if (!basis) {
       // todo(aykut) We should do this through messages as in the rest of the code.
         throw CoinError("Out of memory", "DcoDecodeWarmStart", "HELP");
     }
-    basis_->assignBasisStatus(numCols, numRows,
-                              structuralStatus, artificialStatus);
+    basis->assignBasisStatus(numCols, numRows,
+                             structuralStatus, artificialStatus);
     assert(!structuralStatus);
     assert(!artificialStatus);
-  }
-  else {
-    basis_ = NULL;
+    // decoded basis is stored in full.
+    setBasis(basis, 0);
   }
   return status;
 }
@@ -18,10 +18,11 @@
 #ifndef DcoNodeDesc_hpp_
 #define DcoNodeDesc_hpp_
 
-#include <CoinWarmStartBasis.hpp>
 #include <CoinWarmStartBasis.hpp>
 #include <BcpsNodeDesc.h>
 #include "DcoModel.hpp"
+#include "DcoWarmStart.hpp"
+#include "DcoSlabAllocator.hpp"
 #include "Dco.hpp"
 
 /*!
@@ -81,8 +82,14 @@ class DcoNodeDesc: public BcpsNodeDesc {
   int branchedInd_;
   /** Branched value to create it. For updating pseudocost. */
   double branchedVal_;
-  /** Warm start. */
-  CoinWarmStartBasis * basis_;
+  /** Warm start, may be shared with other nodes. */
+  DcoWarmStart * basis_;
+  /** Number of levels from the closest explicit ancestor, 0 for explicit
+      nodes. */
+  int diffDepth_;
+  /** Bytes of bound differencing accumulated from the closest explicit
+      ancestor, this node included. */
+  int diffBytes_;
 public:
   DcoNodeDesc();
   DcoNodeDesc(DcoModel * model);
@@ -94,10 +101,40 @@ public:
   void setBranchedDir(DcoNodeBranchDir dir);
   void setBranchedInd(int ind);
   void setBranchedVal(double val);
-  /** Set basis. */
-  void setBasis(CoinWarmStartBasis *& ws);
-  /** Get warm start basis. */
-  CoinWarmStartBasis * getBasis() const;
+  /** Set basis. Stored relative to the current basis of this description
+      if its diff chain is shorter than maxChainLength. Takes ownership of
+      ws. */
+  void setBasis(CoinWarmStartBasis *& ws, int maxChainLength);
+  /** Share given warm start with this description, i.e. the basis of the
+      parent with children. */
+  void shareBasis(DcoWarmStart * ws);
+  /** Get warm start, NULL if there is none. */
+  DcoWarmStart * getWarmStart() const { return basis_; }
+  /** Create warm start basis, NULL if there is none. Caller owns the
+      returned basis. */
+  CoinWarmStartBasis * createBasis() const;
+  /** Get number of levels from the closest explicit ancestor. */
+  int getDiffDepth() const { return diffDepth_; }
+  /** Set number of levels from the closest explicit ancestor. */
+  void setDiffDepth(int depth) { diffDepth_ = depth; }
+  /** Get bytes of bound differencing from the closest explicit ancestor. */
+  int getDiffBytes() const { return diffBytes_; }
+  /** Set bytes of bound differencing from the closest explicit ancestor. */
+  void setDiffBytes(int bytes) { diffBytes_ = bytes; }
+  /** Bytes used by the bound modifications stored in this description. */
+  int boundBytes() const;
+  /** Append constraints to the ones added by this description. Takes
+      ownership of the constraints, not the array. */
+  void appendCons(int num, BcpsObject * const * cons);
+  /** Remove constraints from the list of the node. Positions are relative
+      to the list after the additions of this description, the first
+      numInherited ones come from ancestors. Own constraints are deleted,
+      inherited ones are recorded in posRemove. */
+  void removeCons(int numInherited, int num, int const * pos);
+  /** Store the constraint list of the node in full. inherited is the list
+      of the parent. Inherited constraints that are not removed are copied
+      in front of the own ones and posRemove is cleared. */
+  void makeConsExplicit(std::vector<DcoConstraint*> const & inherited);
 
   ///@name Encode and Decode functions
   //@{
@@ -112,6 +149,15 @@ public:
   virtual AlpsReturnStatus decodeToSelf(AlpsEncoded & encoded);
   //@}
 
+  ///@name Memory management
+  //@{
+  /// Allocate from the node description slab allocator.
+  static void * operator new(std::size_t size);
+  /// Give memory back to the node description slab allocator.
+  static void operator delete(void * ptr, std::size_t size);
+  /// Slab allocator of node descriptions, for statistics.
+  static DcoSlabAllocator const & allocator();
+  //@}
 };
 
 #endif
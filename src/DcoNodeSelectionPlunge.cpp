@@ -0,0 +1,125 @@
+/*===========================================================================*
+ * This file is part of the Discrete Conic Optimization (DisCO) Solver.      *
+ *                                                                           *
+ * DisCO is distributed under the Eclipse Public License as part of the      *
+ * COIN-OR repository (http://www.coin-or.org).                              *
+ *                                                                           *
+ * Authors:                                                                  *
+ *          Aykut Bulut, Lehigh University                                   *
+ *          Yan Xu, Lehigh University                                        *
+ *          Ted Ralphs, Lehigh University                                    *
+ *                                                                           *
+ * Copyright (C) 2001-2018, Lehigh University, Aykut Bulut, Yan Xu, and      *
+ *                          Ted Ralphs.                                      *
+ * All Rights Reserved.                                                      *
+ *===========================================================================*/
+
+
+#include "DcoNodeSelectionPlunge.hpp"
+#include "DcoModel.hpp"
+#include "DcoNodeDesc.hpp"
+
+#include <AlpsSubTree.h>
+#include <AlpsKnowledgeBroker.h>
+#include <CoinHelperFunctions.hpp>
+
+#include <cmath>
+
+DcoNodeSelectionPlunge::DcoNodeSelectionPlunge() {
+  plungeDepth_ = 0;
+}
+
+DcoNodeSelectionPlunge::~DcoNodeSelectionPlunge() {
+}
+
+bool DcoNodeSelectionPlunge::compare(AlpsTreeNode * x, AlpsTreeNode * y) {
+  return x->getQuality() > y->getQuality();
+}
+
+AlpsTreeNode *
+DcoNodeSelectionPlunge::selectNextNode(AlpsSubTree * subTree) {
+  DcoModel * model =
+    dynamic_cast<DcoModel*>(subTree->getKnowledgeBroker()->getModel());
+  int plunge_child = model->dcoPar()->entry(DcoParams::plungeChild);
+  AlpsNodePool * dive_pool = subTree->diveNodePool();
+  AlpsNodePool * node_pool = subTree->nodePool();
+
+  // pick the plunge child among the children of the last branched node,
+  // move the rest to the node pool.
+  AlpsTreeNode * node = NULL;
+  while (dive_pool->hasKnowledge()) {
+    AlpsTreeNode * child =
+      dynamic_cast<AlpsTreeNode*>(dive_pool->getKnowledge().first);
+    dive_pool->popKnowledge();
+    DcoNodeDesc * desc = dynamic_cast<DcoNodeDesc*>(child->getDesc());
+    DcoNodeBranchDir dir = desc->getBranchedDir();
+    bool match = false;
+    switch (plunge_child) {
+    case DcoPlungeChildDown:
+      match = (dir==DcoNodeBranchDirectionDown);
+      break;
+    case DcoPlungeChildUp:
+      match = (dir==DcoNodeBranchDirectionUp);
+      break;
+    case DcoPlungeChildRound:
+      {
+        double value = desc->getBranchedVal();
+        DcoNodeBranchDir round_dir = (value-floor(value)<0.5) ?
+          DcoNodeBranchDirectionDown : DcoNodeBranchDirectionUp;
+        match = (dir==round_dir);
+      }
+      break;
+    default:
+      break;
+    }
+    if (match && node==NULL) {
+      node = child;
+    }
+    else {
+      node_pool->addKnowledge(child, child->getQuality());
+    }
+  }
+
+  // stop plunging if the child is far behind the best node.
+  if (node && node_pool->hasKnowledge()) {
+    double best = dynamic_cast<AlpsTreeNode*>
+      (node_pool->getKnowledge().first)->getQuality();
+    double gap = (node->getQuality()-best)/CoinMax(fabs(best), 1.0);
+    if (gap>model->dcoPar()->entry(DcoParams::plungeMaxGap)) {
+      node_pool->addKnowledge(node, node->getQuality());
+      node = NULL;
+      model->addPlungeGapStop();
+    }
+  }
+
+  if (node) {
+    plungeDepth_++;
+    model->addPlungeNode(plungeDepth_);
+  }
+  else if (node_pool->hasKnowledge()) {
+    plungeDepth_ = 0;
+    node = dynamic_cast<AlpsTreeNode*>(node_pool->getKnowledge().first);
+    node_pool->popKnowledge();
+  }
+  return node;
+}
+
+void DcoNodeSelectionPlunge::createNewNodes(AlpsSubTree * subTree,
+                                            AlpsTreeNode * node) {
+  switch (node->getStatus()) {
+  case AlpsNodeStatusPregnant:
+    {
+      std::vector< CoinTriple<AlpsNodeDesc*, AlpsNodeStatus, double> >
+        children = node->branch();
+      subTree->createChildren(node, children, subTree->diveNodePool());
+    }
+    break;
+  case AlpsNodeStatusCandidate:
+  case AlpsNodeStatusEvaluated:
+    subTree->nodePool()->addKnowledge(node, node->getQuality());
+    break;
+  default:
+    // fathomed or branched, nothing to create.
+    break;
+  }
+}
@@ -0,0 +1,70 @@
+/*===========================================================================*
+ * This file is part of the Discrete Conic Optimization (DisCO) Solver.      *
+ *                                                                           *
+ * DisCO is distributed under the Eclipse Public License as part of the      *
+ * COIN-OR repository (http://www.coin-or.org).                              *
+ *                                                                           *
+ * Authors:                                                                  *
+ *          Aykut Bulut, Lehigh University                                   *
+ *          Yan Xu, Lehigh University                                        *
+ *          Ted Ralphs, Lehigh University                                    *
+ *                                                                           *
+ * Copyright (C) 2001-2018, Lehigh University, Aykut Bulut, Yan Xu, and      *
+ *                          Ted Ralphs.                                      *
+ * All Rights Reserved.                                                      *
+ *===========================================================================*/
+
+
+#ifndef DcoNodeSelectionPlunge_hpp_
+#define DcoNodeSelectionPlunge_hpp_
+
+#include <AlpsSearchStrategy.h>
+#include <AlpsTreeNode.h>
+
+/*!
+  Node selection rule that plunges into a child of the node just branched.
+
+  After a node is branched its children are kept in the dive pool of the
+  subtree and the child given by parameter plungeChild is processed next.
+  Since it is a child of the node installed in the solver, installing it
+  keeps the cuts of the parent in the solver row pool and changes only the
+  bounds set by branching. Unless strong branching stored a basis for the
+  child, the solver is not given a new warm start and resolves from the
+  state the parent left. The other child goes to the node pool.
+
+  A plunge ends when the node is fathomed, or when the relative gap between
+  the bound of the child and the best bound in the node pool exceeds
+  parameter plungeMaxGap. The node pool is searched best first.
+*/
+
+class DcoNodeSelectionPlunge: public AlpsSearchStrategy<AlpsTreeNode*> {
+  /// Number of nodes processed in the current plunge.
+  int plungeDepth_;
+public:
+  ///@name Constructor and Destructor.
+  //@{
+  /// Constructor.
+  DcoNodeSelectionPlunge();
+  /// Destructor.
+  virtual ~DcoNodeSelectionPlunge();
+  //@}
+
+  ///@name Virtual functions from AlpsSearchStrategy
+  //@{
+  /// Return true if y is a better node than x, ie. has a smaller bound.
+  virtual bool compare(AlpsTreeNode * x, AlpsTreeNode * y);
+  /// Select the plunge child if there is one and plunging should go on,
+  /// best node of the node pool otherwise.
+  virtual AlpsTreeNode * selectNextNode(AlpsSubTree * subTree);
+  /// Create the children of a branched node into the dive pool.
+  virtual void createNewNodes(AlpsSubTree * subTree, AlpsTreeNode * node);
+  //@}
+
+private:
+  /// Disable copy constructor.
+  DcoNodeSelectionPlunge(DcoNodeSelectionPlunge const & other);
+  /// Disable copy assignment operator.
+  DcoNodeSelectionPlunge & operator=(DcoNodeSelectionPlunge const & rhs);
+};
+
+#endif
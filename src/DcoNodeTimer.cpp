@@ -0,0 +1,185 @@
+/*===========================================================================*
+ * This file is part of the Discrete Conic Optimization (DisCO) Solver.      *
+ *                                                                           *
+ * DisCO is distributed under the Eclipse Public License as part of the      *
+ * COIN-OR repository (http://www.coin-or.org).                              *
+ *                                                                           *
+ * Authors:                                                                  *
+ *          Aykut Bulut, Lehigh University                                   *
+ *          Yan Xu, Lehigh University                                        *
+ *          Ted Ralphs, Lehigh University                                    *
+ *                                                                           *
+ * Copyright (C) 2001-2018, Lehigh University, Aykut Bulut, Yan Xu, and      *
+ *                          Ted Ralphs.                                      *
+ * All Rights Reserved.                                                      *
+ *===========================================================================*/
+
+
+#include "DcoNodeTimer.hpp"
+
+#include <CoinTime.hpp>
+#include <CoinHelperFunctions.hpp>
+
+#include <fstream>
+#include <iomanip>
+
+static char const * phaseNames[DcoNodePhaseNum] = {
+  "install",
+  "bound",
+  "feasibility",
+  "generateCons",
+  "applyCons",
+  "checkCuts",
+  "heuristics",
+  "branchCands",
+  "branch"
+};
+
+DcoNodeTimer::DcoNodeTimer() {
+  enabled_ = false;
+  out_ = NULL;
+  json_ = false;
+  inNode_ = false;
+  nodeIndex_ = -1;
+  nodeDepth_ = -1;
+  phase_ = DcoNodePhaseNum;
+  startWall_ = 0.0;
+  startCpu_ = 0.0;
+  numNodes_ = 0;
+  CoinZeroN(nodeWall_, DcoNodePhaseNum);
+  CoinZeroN(nodeCpu_, DcoNodePhaseNum);
+  CoinZeroN(nodeCalls_, DcoNodePhaseNum);
+  CoinZeroN(wall_, DcoNodePhaseNum);
+  CoinZeroN(cpu_, DcoNodePhaseNum);
+  CoinZeroN(calls_, DcoNodePhaseNum);
+  CoinZeroN(&hist_[0][0], DcoNodePhaseNum*numBins);
+}
+
+DcoNodeTimer::~DcoNodeTimer() {
+  finish();
+  if (out_) {
+    delete out_;
+    out_ = NULL;
+  }
+}
+
+void DcoNodeTimer::setup(bool enabled, std::string const & fileName) {
+  enabled_ = enabled;
+  if (out_) {
+    delete out_;
+    out_ = NULL;
+  }
+  if (!enabled_ || fileName.empty()) {
+    return;
+  }
+  json_ = fileName.size()>=5 &&
+    fileName.compare(fileName.size()-5, 5, ".json")==0;
+  out_ = new std::ofstream(fileName.c_str());
+  if (!out_->good()) {
+    delete out_;
+    out_ = NULL;
+    return;
+  }
+  *out_ << std::setprecision(9);
+  if (!json_) {
+    *out_ << "index,depth";
+    for (int i=0; i<DcoNodePhaseNum; ++i) {
+      *out_ << "," << phaseNames[i] << "Wall"
+            << "," << phaseNames[i] << "Cpu"
+            << "," << phaseNames[i] << "Calls";
+    }
+    *out_ << std::endl;
+  }
+}
+
+void DcoNodeTimer::beginNode(int index, int depth) {
+  if (!enabled_) {
+    return;
+  }
+  endNode();
+  inNode_ = true;
+  nodeIndex_ = index;
+  nodeDepth_ = depth;
+}
+
+void DcoNodeTimer::start(DcoNodePhase phase) {
+  if (!enabled_) {
+    return;
+  }
+  phase_ = phase;
+  startWall_ = CoinGetTimeOfDay();
+  startCpu_ = CoinCpuTime();
+}
+
+void DcoNodeTimer::stop() {
+  if (!enabled_ || phase_==DcoNodePhaseNum) {
+    return;
+  }
+  nodeWall_[phase_] += CoinGetTimeOfDay() - startWall_;
+  nodeCpu_[phase_] += CoinCpuTime() - startCpu_;
+  nodeCalls_[phase_]++;
+  phase_ = DcoNodePhaseNum;
+}
+
+void DcoNodeTimer::finish() {
+  endNode();
+  if (out_) {
+    out_->flush();
+  }
+}
+
+void DcoNodeTimer::endNode() {
+  if (!inNode_) {
+    return;
+  }
+  inNode_ = false;
+  numNodes_++;
+  for (int i=0; i<DcoNodePhaseNum; ++i) {
+    if (nodeCalls_[i]==0) {
+      continue;
+    }
+    wall_[i] += nodeWall_[i];
+    cpu_[i] += nodeCpu_[i];
+    calls_[i] += nodeCalls_[i];
+    int bin = 0;
+    while (bin<numBins-1 && nodeWall_[i]>=binLimit(bin)) {
+      bin++;
+    }
+    hist_[i][bin]++;
+  }
+  if (out_) {
+    if (json_) {
+      *out_ << "{\"index\":" << nodeIndex_ << ",\"depth\":" << nodeDepth_;
+      for (int i=0; i<DcoNodePhaseNum; ++i) {
+        *out_ << ",\"" << phaseNames[i] << "\":{\"wall\":" << nodeWall_[i]
+              << ",\"cpu\":" << nodeCpu_[i]
+              << ",\"calls\":" << nodeCalls_[i] << "}";
+      }
+      *out_ << "}\n";
+    }
+    else {
+      *out_ << nodeIndex_ << "," << nodeDepth_;
+      for (int i=0; i<DcoNodePhaseNum; ++i) {
+        *out_ << "," << nodeWall_[i] << "," << nodeCpu_[i]
+              << "," << nodeCalls_[i];
+      }
+      *out_ << "\n";
+    }
+  }
+  CoinZeroN(nodeWall_, DcoNodePhaseNum);
+  CoinZeroN(nodeCpu_, DcoNodePhaseNum);
+  CoinZeroN(nodeCalls_, DcoNodePhaseNum);
+}
+
+char const * DcoNodeTimer::phaseName(int phase) {
+  return phaseNames[phase];
+}
+
+double DcoNodeTimer::binLimit(int bin) {
+  // 10 microseconds, multiplied by 10 for each bin.
+  double limit = 1.0e-5;
+  for (int k=0; k<bin; ++k) {
+    limit *= 10.0;
+  }
+  return limit;
+}
@@ -0,0 +1,132 @@
+/*===========================================================================*
+ * This file is part of the Discrete Conic Optimization (DisCO) Solver.      *
+ *                                                                           *
+ * DisCO is distributed under the Eclipse Public License as part of the      *
+ * COIN-OR repository (http://www.coin-or.org).                              *
+ *                                                                           *
+ * Authors:                                                                  *
+ *          Aykut Bulut, Lehigh University                                   *
+ *          Yan Xu, Lehigh University                                        *
+ *          Ted Ralphs, Lehigh University                                    *
+ *                                                                           *
+ * Copyright (C) 2001-2018, Lehigh University, Aykut Bulut, Yan Xu, and      *
+ *                          Ted Ralphs.                                      *
+ * All Rights Reserved.                                                      *
+ *===========================================================================*/
+
+
+#ifndef DcoNodeTimer_hpp_
+#define DcoNodeTimer_hpp_
+
+#include <iosfwd>
+#include <string>
+
+#include "Dco.hpp"
+
+/*!
+  Measures wall clock and CPU time spent in each phase of processing nodes,
+  see DcoNodePhase.
+
+  Times of a node are collected between calls to beginNode(). When a node
+  is finished its phase times are added to the totals and to a histogram of
+  per node wall clock times for each phase. Histogram bin k counts the nodes
+  that spent less than binLimit(k) seconds in the phase, the last bin counts
+  the rest.
+
+  If a file name is given, a record of each node is written to it, CSV or
+  JSON (one object per line) depending on file extension.
+*/
+
+class DcoNodeTimer {
+public:
+  /// Number of histogram bins.
+  static int const numBins = 8;
+private:
+  /// True if timing is enabled.
+  bool enabled_;
+  /// Per node records are written to this stream, NULL if not requested.
+  std::ofstream * out_;
+  /// True if records are written in JSON, CSV otherwise.
+  bool json_;
+  /// True if a node is being timed.
+  bool inNode_;
+  /// Index of the node being timed.
+  int nodeIndex_;
+  /// Depth of the node being timed.
+  int nodeDepth_;
+  /// Phase being timed, DcoNodePhaseNum if there is none.
+  int phase_;
+  /// Wall clock time the phase started.
+  double startWall_;
+  /// CPU time the phase started.
+  double startCpu_;
+  /// Wall clock time of the node in each phase.
+  double nodeWall_[DcoNodePhaseNum];
+  /// CPU time of the node in each phase.
+  double nodeCpu_[DcoNodePhaseNum];
+  /// Number of times the node entered each phase.
+  int nodeCalls_[DcoNodePhaseNum];
+  /// Number of nodes timed.
+  int numNodes_;
+  /// Total wall clock time of each phase.
+  double wall_[DcoNodePhaseNum];
+  /// Total CPU time of each phase.
+  double cpu_[DcoNodePhaseNum];
+  /// Number of times each phase is entered.
+  int calls_[DcoNodePhaseNum];
+  /// Histogram of per node wall clock times of each phase.
+  int hist_[DcoNodePhaseNum][numBins];
+  /// Finish the node being timed, update totals and write its record.
+  void endNode();
+public:
+  ///@name Constructor and Destructor.
+  //@{
+  /// Constructor, timing is disabled.
+  DcoNodeTimer();
+  /// Destructor. Finishes the node being timed and closes the file.
+  ~DcoNodeTimer();
+  //@}
+
+  ///@name Timing
+  //@{
+  /// Enable timing. Per node records are written to fileName if it is not
+  /// empty.
+  void setup(bool enabled, std::string const & fileName);
+  /// Return true if timing is enabled.
+  bool enabled() const { return enabled_; }
+  /// Finish the previous node and start timing given node.
+  void beginNode(int index, int depth);
+  /// Start timing phase, phases do not nest.
+  void start(DcoNodePhase phase);
+  /// Stop timing the phase started last.
+  void stop();
+  /// Finish the node being timed and flush the file.
+  void finish();
+  //@}
+
+  ///@name Get statistics
+  //@{
+  /// Number of nodes timed.
+  int numNodes() const { return numNodes_; }
+  /// Total wall clock time of phase.
+  double wall(int phase) const { return wall_[phase]; }
+  /// Total CPU time of phase.
+  double cpu(int phase) const { return cpu_[phase]; }
+  /// Number of times phase is entered.
+  int calls(int phase) const { return calls_[phase]; }
+  /// Number of nodes in histogram bin of phase.
+  int histogram(int phase, int bin) const { return hist_[phase][bin]; }
+  /// Name of phase.
+  static char const * phaseName(int phase);
+  /// Upper limit of histogram bin in seconds.
+  static double binLimit(int bin);
+  //@}
+
+private:
+  /// Disable copy constructor.
+  DcoNodeTimer(DcoNodeTimer const & other);
+  /// Disable copy assignment operator.
+  DcoNodeTimer & operator=(DcoNodeTimer const & rhs);
+};
+
+#endif
@@ -42,6 +42,13 @@ void DcoParams::createKeywordList() {
   keys_.push_back(make_pair(std::string("Dco_sharePseudocostSearch"),
                             AlpsParameter(AlpsBoolPar,
                                           sharePseudocostSearch)));
+  keys_.push_back(make_pair(std::string("Dco_nodeTiming"),
+                            AlpsParameter(AlpsBoolPar, nodeTiming)));
+  keys_.push_back(make_pair(std::string("Dco_separateViolatedCones"),
+                            AlpsParameter(AlpsBoolPar,
+                                          separateViolatedCones)));
+  keys_.push_back(make_pair(std::string("Dco_pseudoProductScore"),
+                            AlpsParameter(AlpsBoolPar, pseudoProductScore)));
   //--------------------------------------------------------
   // BoolArrayPar
   //--------------------------------------------------------
@@ -156,6 +163,26 @@ void DcoParams::createKeywordList() {
                             AlpsParameter(AlpsIntPar, presolveNumPass)));
   keys_.push_back(make_pair(std::string("Dco_approxNumPass"),
                             AlpsParameter(AlpsIntPar, approxNumPass)));
+  keys_.push_back(make_pair(std::string("Dco_snapshotDepth"),
+                            AlpsParameter(AlpsIntPar, snapshotDepth)));
+  keys_.push_back(make_pair(std::string("Dco_snapshotBytes"),
+                            AlpsParameter(AlpsIntPar, snapshotBytes)));
+  keys_.push_back(make_pair(std::string("Dco_basisChainLength"),
+                            AlpsParameter(AlpsIntPar, basisChainLength)));
+  keys_.push_back(make_pair(std::string("Dco_plungeChild"),
+                            AlpsParameter(AlpsIntPar, plungeChild)));
+  keys_.push_back(make_pair(std::string("Dco_compactNodeMemory"),
+                            AlpsParameter(AlpsIntPar, compactNodeMemory)));
+  keys_.push_back(make_pair(std::string("Dco_cutPoolMaxAge"),
+                            AlpsParameter(AlpsIntPar, cutPoolMaxAge)));
+  keys_.push_back(make_pair(std::string("Dco_cutGenThreads"),
+                            AlpsParameter(AlpsIntPar, cutGenThreads)));
+  keys_.push_back(make_pair(std::string("Dco_strongIterLimit"),
+                            AlpsParameter(AlpsIntPar, strongIterLimit)));
+  keys_.push_back(make_pair(std::string("Dco_strongThreads"),
+                            AlpsParameter(AlpsIntPar, strongThreads)));
+  keys_.push_back(make_pair(std::string("Dco_rowPoolMaxFree"),
+                            AlpsParameter(AlpsIntPar, rowPoolMaxFree)));
   //--------------------------------------------------------
   // Double Parameters.
   //--------------------------------------------------------
@@ -195,9 +222,31 @@ void DcoParams::createKeywordList() {
                             AlpsParameter(AlpsDoublePar, cutOaSlack2)));
   keys_.push_back(make_pair(std::string("Dco_cutMilpDelta"),
                             AlpsParameter(AlpsDoublePar, cutMilpDelta)));
+  keys_.push_back(make_pair(std::string("Dco_plungeMaxGap"),
+                            AlpsParameter(AlpsDoublePar, plungeMaxGap)));
+  keys_.push_back(make_pair(std::string("Dco_cutDuplicateTol"),
+                            AlpsParameter(AlpsDoublePar, cutDuplicateTol)));
+  keys_.push_back(make_pair(std::string("Dco_cutParallelTol"),
+                            AlpsParameter(AlpsDoublePar, cutParallelTol)));
+  keys_.push_back(make_pair(std::string("Dco_cutObjParallelWeight"),
+                            AlpsParameter(AlpsDoublePar,
+                                          cutObjParallelWeight)));
+  keys_.push_back(make_pair(std::string("Dco_cutMinOrthogonality"),
+                            AlpsParameter(AlpsDoublePar,
+                                          cutMinOrthogonality)));
+  keys_.push_back(make_pair(std::string("Dco_approxMinRate"),
+                            AlpsParameter(AlpsDoublePar, approxMinRate)));
+  keys_.push_back(make_pair(std::string("Dco_pseudoInfPenalty"),
+                            AlpsParameter(AlpsDoublePar, pseudoInfPenalty)));
+  keys_.push_back(make_pair(std::string("Dco_coneBranchWeight"),
+                            AlpsParameter(AlpsDoublePar, coneBranchWeight)));
 //--------------------------------------------------------
   // String Parameters.
   //--------------------------------------------------------
+  keys_.push_back(make_pair(std::string("Dco_nodeTimingFile"),
+                            AlpsParameter(AlpsStringPar, nodeTimingFile)));
+  keys_.push_back(make_pair(std::string("Dco_rootCacheDir"),
+                            AlpsParameter(AlpsStringPar, rootCacheDir)));
 }
 
 //#############################################################################
@@ -215,6 +264,9 @@ void DcoParams::setDefaultEntries() {
   // presolve parameters
   setEntry(presolveKeepIntegers, true);
   setEntry(presolveTransform, true);
+  setEntry(nodeTiming, false);
+  setEntry(separateViolatedCones, true);
+  setEntry(pseudoProductScore, false);
   //-------------------------------------------------------------
   // Int Parameters.
   //-------------------------------------------------------------
@@ -265,6 +317,16 @@ void DcoParams::setDefaultEntries() {
   setEntry(logLevel, 2);
   setEntry(presolveNumPass, 5);
   setEntry(approxNumPass, 400);
+  setEntry(snapshotDepth, 50);
+  setEntry(snapshotBytes, 0);
+  setEntry(basisChainLength, 8);
+  setEntry(plungeChild, 0);
+  setEntry(compactNodeMemory, 0);
+  setEntry(cutPoolMaxAge, 20);
+  setEntry(cutGenThreads, 1);
+  setEntry(strongIterLimit, 50);
+  setEntry(strongThreads, 1);
+  setEntry(rowPoolMaxFree, 1000);
   //-------------------------------------------------------------
   // Double Parameters
   //-------------------------------------------------------------
@@ -290,7 +352,17 @@ void DcoParams::setDefaultEntries() {
   setEntry(cutOaBeta, 0.001);
   /// MILP cut generation strategy parameters
   setEntry(cutMilpDelta, 0.0001);
+  setEntry(plungeMaxGap, 0.1);
+  setEntry(cutDuplicateTol, 0.99999);
+  setEntry(cutParallelTol, 0.95);
+  setEntry(cutObjParallelWeight, 0.1);
+  setEntry(cutMinOrthogonality, 0.1);
+  setEntry(approxMinRate, 1e-3);
+  setEntry(pseudoInfPenalty, 10.0);
+  setEntry(coneBranchWeight, 0.0);
   //-------------------------------------------------------------
   // String Parameters
   //-------------------------------------------------------------
+  setEntry(nodeTimingFile, "");
+  setEntry(rootCacheDir, "");
 }
@@ -32,7 +32,8 @@ public:
     cutRampUp,
     /// Presolve or not
     presolve,
-    ///Share constraints Default: false
+    /// Keep globally valid cuts in a pool shared by all nodes, see
+    /// DcoCutPool. Default: false
     shareConstraints,
     /// Share constraints Default: false
     shareVariables,
@@ -43,6 +44,17 @@ public:
     /// presolve boolean parameters
     presolveKeepIntegers,
     presolveTransform,
+    /** Collect wall clock and CPU time of node processing phases.
+        Default: false */
+    nodeTiming,
+    /** Pass only the cones violated by the current solution to conic cut
+        generators. See DcoModel::checkConeFeasibility().
+        Default: true */
+    separateViolatedCones,
+    /** Score pseudocost candidates with the product of the down and up
+        estimates instead of the pseudoWeight weighted min and max.
+        Default: false */
+    pseudoProductScore,
     //
     endOfChrParams
   };
@@ -80,6 +92,8 @@ public:
     /// OA cut strategy parameters
     cutOaAlpha,
     cutOaGamma,
+    /// Cuts inactive in more than this many consecutive bounding iterations
+    /// are deleted before the next resolve. Default: 3
     cutOaSlackLimit,
     cutMilpGamma,
     ///
@@ -112,9 +126,12 @@ public:
     lookAhead,
     /** The reliability of pseudocost. */
     pseudoReliability,
-    /** Maximum tree depth of sharing pseudocost. */
+    /** Maximum tree depth of sharing pseudocost. Observations of deeper
+        nodes are not sent to other processes. Default: 30 */
     sharePcostDepth,
-    /** Frequency of sharing pseudocost. */
+    /** Frequency of sharing pseudocost. During search pseudocosts are shared
+        once this many nodes are processed since the last share.
+        Default: 100 */
     sharePcostFrequency,
     /** The number of candidate used in strong branching. Default: 10. */
     strongCandSize,
@@ -138,14 +155,49 @@ public:
     presolveNumPass,
     // approximation passes, used in OA, overwrites approxFactor
     approxNumPass,
+    /** Store a full node description every this many levels below the
+        closest explicit ancestor. 0 disables. Default: 50 */
+    snapshotDepth,
+    /** Store a full node description when the bound differencing
+        accumulated from the closest explicit ancestor exceeds this many
+        bytes. 0 disables. Default: 0 */
+    snapshotBytes,
+    /** Maximum number of diffs between a stored warm start basis and the
+        closest basis stored in full. 0 stores all bases in full. Default: 8 */
+    basisChainLength,
+    /** Child chosen to plunge into after branching: 0 no plunging, 1 down,
+        2 up, 3 the direction the branching value rounds to. Default: 0 */
+    plungeChild,
+    /** Explicit nodes are converted back to relative when their bound arrays
+        take more memory than this, in MB. 0 disables. Default: 0 */
+    compactNodeMemory,
+    /** Cuts of the global cut pool that are not violated in this many
+        consecutive separations are removed. Used when shareConstraints is set.
+        Default: 20 */
+    cutPoolMaxAge,
+    /** Number of threads that run constraint generators concurrently, each on
+        a snapshot of the solver. Initial cone approximation splits violated
+        cones among this many threads as well. Needs a build with OpenMP,
+        e.g., configure with ADD_CXXFLAGS=-fopenmp. Default: 1 */
+    cutGenThreads,
+    /** Maximum number of simplex iterations to solve a child in strong and
+        reliability branching. Default: 50 */
+    strongIterLimit,
+    /** Number of threads that evaluate strong branching candidates, each
+        on a clone of the solver. Needs a build with OpenMP. Default: 1 */
+    strongThreads,
+    /** Maximum number of relaxed rows kept in the solver row pool. Relaxed
+        rows are deleted from solver when exceeded. Default: 1000 */
+    rowPoolMaxFree,
     ///
     endOfIntParams
   };
 
   /** Double parameters. */
   enum dblParams {
-    /** Limit the max number cuts applied at a node.
-        maxNumCons = (CutFactor - 1) * numCoreConstraints. */
+    /** Limit the max number cuts applied at a node in a round.
+        maxNumCons = (CutFactor - 1) * numCoreConstraints. No limit if it is
+        not greater than 1. */
     cutFactor,
     /** Cutoff any nodes whose objective value is higher than it. */
     cutoff,
@@ -166,7 +218,8 @@ public:
     /** If the absolute gap between best feasible and best relaxed fall into
         this gap, search stops. Default: 1.0e-4 */
     optimalAbsGap,
-    /** Weight used to calculate pseudocost. */
+    /** Weight of the minimum of the down and up estimates in the pseudocost
+        score, 1 - pseudoWeight is the weight of the maximum. Default: 0.8 */
     pseudoWeight,
     /** Scaling indicator of a constraint.*/
     scaleConFactor,
@@ -185,11 +238,48 @@ public:
     /// MILP cut tailoff, keep generating as long as imprvement is larger than
     /// delta
     cutMilpDelta,
+    /** Plunging stops when the relative gap between the bound of the child
+        and the best bound of the other nodes exceeds it. Default: 0.1 */
+    plungeMaxGap,
+    /** A cut is a duplicate of a solver row if the cosine of the angle between
+        them exceeds it. Default: 0.99999 */
+    cutDuplicateTol,
+    /** A cut is discarded as almost parallel to a solver row if the cosine of
+        the angle between them exceeds it. Default: 0.95 */
+    cutParallelTol,
+    /** Weight of objective parallelism in the score of a cut, see
+        DcoTreeNode::selectCuts(). Default: 0.1 */
+    cutObjParallelWeight,
+    /** Minimum orthogonality, 1 - |cosine|, of a cut to the cuts already
+        selected in the same round. Default: 0.1 */
+    cutMinOrthogonality,
+    /** Initial cone approximation stops when the relative bound improvement
+        per second of an approximation round drops below this value.
+        approxNumPass still limits the number of rounds. 0 disables.
+        Default: 1e-3 */
+    approxMinRate,
+    /** An infeasible child is recorded as a pseudocost observation this many
+        times the average pseudocost of its direction. Default: 10.0 */
+    pseudoInfPenalty,
+    /** Weight of cone violation in pseudocost branching scores. Score of a
+        candidate is multiplied by 1 + coneBranchWeight times the sum of
+        violations of relaxed cones it is a member of, relative to the largest
+        violation. 0 disables. Default: 0.0 */
+    coneBranchWeight,
     endOfDblParams
   };
   /** String parameters. */
   enum strParams{
     strDummy,
+    /** File to write phase times of each node when nodeTiming is set, CSV
+        or JSON (.json extension). Empty for no file. Default: empty */
+    nodeTimingFile,
+    /** Directory of the root cache. Initial cone approximation cuts, root
+        cuts and root basis are stored in a file named by a hash of the
+        instance structure and reused by later runs on the same instance,
+        cone approximation cuts also on instances with the same structure.
+        Used with OA. Empty for no cache. Default: empty */
+    rootCacheDir,
     //
     endOfStrParams
   };
@@ -0,0 +1,245 @@
+/*===========================================================================*
+ * This file is part of the Discrete Conic Optimization (DisCO) Solver.      *
+ *                                                                           *
+ * DisCO is distributed under the Eclipse Public License as part of the      *
+ * COIN-OR repository (http://www.coin-or.org).                              *
+ *                                                                           *
+ * Authors:                                                                  *
+ *          Aykut Bulut, Lehigh University                                   *
+ *          Yan Xu, Lehigh University                                        *
+ *          Ted Ralphs, Lehigh University                                    *
+ *                                                                           *
+ * Copyright (C) 2001-2018, Lehigh University, Aykut Bulut, Yan Xu, and      *
+ *                          Ted Ralphs.                                      *
+ * All Rights Reserved.                                                      *
+ *===========================================================================*/
+
+
+#include "DcoRootCache.hpp"
+
+#include <CoinPackedMatrix.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+
+/// Identifies cache files and their format version.
+static char const cacheMagic[8] = {'D', 'c', 'o', 'R', 'o', 'o', 't', '1'};
+
+/// Write a value in binary.
+template<class T>
+static void writeValue(std::ostream & os, T const & value) {
+  os.write(reinterpret_cast<char const *>(&value), sizeof(T));
+}
+
+/// Read a value in binary.
+template<class T>
+static void readValue(std::istream & is, T & value) {
+  is.read(reinterpret_cast<char *>(&value), sizeof(T));
+}
+
+/// Write size of the vector and its elements in binary.
+template<class T>
+static void writeVector(std::ostream & os, std::vector<T> const & vec) {
+  int size = static_cast<int>(vec.size());
+  writeValue(os, size);
+  if (size) {
+    os.write(reinterpret_cast<char const *>(&vec[0]), size*sizeof(T));
+  }
+}
+
+/// Read a vector written by writeVector().
+template<class T>
+static void readVector(std::istream & is, std::vector<T> & vec) {
+  int size = 0;
+  readValue(is, size);
+  if (!is || size<0) {
+    vec.clear();
+    return;
+  }
+  vec.resize(size);
+  if (size) {
+    is.read(reinterpret_cast<char *>(&vec[0]), size*sizeof(T));
+  }
+}
+
+DcoRootCache::DcoRootCache() {
+  structureKey_ = 0;
+  dataKey_ = 0;
+  dataMatch_ = false;
+  numConeCuts_ = 0;
+  start_.push_back(0);
+  basis_ = NULL;
+}
+
+DcoRootCache::~DcoRootCache() {
+  delete basis_;
+}
+
+void DcoRootCache::setup(std::string const & dir, std::size_t structureKey,
+                         std::size_t dataKey) {
+  dir_ = dir;
+  structureKey_ = structureKey;
+  dataKey_ = dataKey;
+}
+
+std::string DcoRootCache::fileName() const {
+  std::stringstream name;
+  name << dir_ << "/disco-" << std::hex << structureKey_ << ".cache";
+  return name.str();
+}
+
+bool DcoRootCache::load() {
+  dataMatch_ = false;
+  numConeCuts_ = 0;
+  start_.assign(1, 0);
+  index_.clear();
+  value_.clear();
+  lb_.clear();
+  ub_.clear();
+  delete basis_;
+  basis_ = NULL;
+  if (!enabled()) {
+    return false;
+  }
+  std::ifstream is(fileName().c_str(), std::ios::binary);
+  char magic[8];
+  is.read(magic, 8);
+  std::size_t structure_key = 0;
+  std::size_t data_key = 0;
+  readValue(is, structure_key);
+  readValue(is, data_key);
+  if (!is || !std::equal(magic, magic+8, cacheMagic) ||
+      structure_key!=structureKey_) {
+    return false;
+  }
+  int num_cone_cuts = 0;
+  readValue(is, num_cone_cuts);
+  readVector(is, start_);
+  readVector(is, index_);
+  readVector(is, value_);
+  readVector(is, lb_);
+  readVector(is, ub_);
+  int num_rows = static_cast<int>(lb_.size());
+  bool valid = is && static_cast<int>(start_.size())==num_rows+1 &&
+    static_cast<int>(ub_.size())==num_rows && num_cone_cuts<=num_rows &&
+    start_[num_rows]==static_cast<CoinBigIndex>(index_.size()) &&
+    index_.size()==value_.size();
+  if (!valid) {
+    start_.assign(1, 0);
+    index_.clear();
+    value_.clear();
+    lb_.clear();
+    ub_.clear();
+    return false;
+  }
+  numConeCuts_ = num_cone_cuts;
+  dataMatch_ = data_key==dataKey_;
+  // basis, status of each variable is stored in a char.
+  std::vector<char> struct_status;
+  std::vector<char> artif_status;
+  readVector(is, struct_status);
+  readVector(is, artif_status);
+  if (dataMatch_ && is && struct_status.size()) {
+    int num_struct = static_cast<int>(struct_status.size());
+    int num_artif = static_cast<int>(artif_status.size());
+    basis_ = new CoinWarmStartBasis();
+    basis_->setSize(num_struct, num_artif);
+    for (int i=0; i<num_struct; ++i) {
+      basis_->setStructStatus(i, static_cast<CoinWarmStartBasis::Status>
+                              (struct_status[i]));
+    }
+    for (int i=0; i<num_artif; ++i) {
+      basis_->setArtifStatus(i, static_cast<CoinWarmStartBasis::Status>
+                             (artif_status[i]));
+    }
+  }
+  return true;
+}
+
+bool DcoRootCache::save(OsiSolverInterface const * solver, int firstRow,
+                        int numConeCuts) {
+  if (!enabled()) {
+    return false;
+  }
+  CoinPackedMatrix const * matrix = solver->getMatrixByRow();
+  double const * row_lb = solver->getRowLower();
+  double const * row_ub = solver->getRowUpper();
+  double infinity = solver->getInfinity();
+  int num_rows = solver->getNumRows();
+  std::vector<CoinBigIndex> start(1, 0);
+  std::vector<int> index;
+  std::vector<double> value;
+  std::vector<double> lb;
+  std::vector<double> ub;
+  bool skipped = false;
+  for (int i=firstRow; i<num_rows; ++i) {
+    // skip rows relaxed to free rows
+    if (row_lb[i]<=-infinity && row_ub[i]>=infinity) {
+      numConeCuts -= (i-firstRow<numConeCuts) ? 1 : 0;
+      skipped = true;
+      continue;
+    }
+    CoinShallowPackedVector row = matrix->getVector(i);
+    int size = row.getNumElements();
+    index.insert(index.end(), row.getIndices(), row.getIndices()+size);
+    value.insert(value.end(), row.getElements(), row.getElements()+size);
+    start.push_back(static_cast<CoinBigIndex>(index.size()));
+    lb.push_back(row_lb[i]);
+    ub.push_back(row_ub[i]);
+  }
+  // basis is stored only if it matches the stored rows.
+  std::vector<char> struct_status;
+  std::vector<char> artif_status;
+  CoinWarmStartBasis * ws = skipped ? NULL :
+    dynamic_cast<CoinWarmStartBasis*> (solver->getWarmStart());
+  if (ws) {
+    for (int i=0; i<ws->getNumStructural(); ++i) {
+      struct_status.push_back(static_cast<char>(ws->getStructStatus(i)));
+    }
+    for (int i=0; i<ws->getNumArtificial(); ++i) {
+      artif_status.push_back(static_cast<char>(ws->getArtifStatus(i)));
+    }
+  }
+  delete ws;
+  // write to a temporary file and rename, readers never see a partial file.
+  std::string file_name = fileName();
+  std::string tmp_name = file_name + ".tmp";
+  {
+    std::ofstream os(tmp_name.c_str(), std::ios::binary);
+    os.write(cacheMagic, 8);
+    writeValue(os, structureKey_);
+    writeValue(os, dataKey_);
+    writeValue(os, numConeCuts);
+    writeVector(os, start);
+    writeVector(os, index);
+    writeVector(os, value);
+    writeVector(os, lb);
+    writeVector(os, ub);
+    writeVector(os, struct_status);
+    writeVector(os, artif_status);
+    if (!os) {
+      return false;
+    }
+  }
+  return std::rename(tmp_name.c_str(), file_name.c_str())==0;
+}
+
+int DcoRootCache::apply(OsiSolverInterface * solver) const {
+  int num_rows = dataMatch_ ? numRows() : numConeCuts_;
+  if (num_rows==0) {
+    return 0;
+  }
+  if (index_.empty()) {
+    return 0;
+  }
+  solver->addRows(num_rows, &start_[0], &index_[0], &value_[0], &lb_[0],
+                  &ub_[0]);
+  if (basis_ && num_rows==numRows() &&
+      basis_->getNumArtificial()==solver->getNumRows() &&
+      basis_->getNumStructural()==solver->getNumCols()) {
+    solver->setWarmStart(basis_);
+  }
+  return num_rows;
+}
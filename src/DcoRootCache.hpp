@@ -0,0 +1,120 @@
+/*===========================================================================*
+ * This file is part of the Discrete Conic Optimization (DisCO) Solver.      *
+ *                                                                           *
+ * DisCO is distributed under the Eclipse Public License as part of the      *
+ * COIN-OR repository (http://www.coin-or.org).                              *
+ *                                                                           *
+ * Authors:                                                                  *
+ *          Aykut Bulut, Lehigh University                                   *
+ *          Yan Xu, Lehigh University                                        *
+ *          Ted Ralphs, Lehigh University                                    *
+ *                                                                           *
+ * Copyright (C) 2001-2018, Lehigh University, Aykut Bulut, Yan Xu, and      *
+ *                          Ted Ralphs.                                      *
+ * All Rights Reserved.                                                      *
+ *===========================================================================*/
+
+
+#ifndef DcoRootCache_hpp_
+#define DcoRootCache_hpp_
+
+#include <CoinTypes.hpp>
+#include <CoinWarmStartBasis.hpp>
+#include <OsiSolverInterface.hpp>
+
+#include <string>
+#include <vector>
+
+/*!
+  On disk cache of the root relaxation. Stores rows added to the solver on
+  top of the linear rows of the instance, i.e., initial cone approximation
+  cuts and root cuts, together with the root basis.
+
+  Cache files are named by a structure key, hash of dimensions, sparsity
+  pattern, integrality and cones of the instance. A data key, hash of all
+  problem data, is stored in the file. Cone approximation cuts are tangents
+  of the cones and they are used when structure keys match. Root cuts and
+  the basis are used only when data keys match too.
+*/
+
+class DcoRootCache {
+  /// Directory of the cache files, empty if cache is not used.
+  std::string dir_;
+  /// Hash of the instance structure.
+  std::size_t structureKey_;
+  /// Hash of the instance data.
+  std::size_t dataKey_;
+  /// True if the loaded file has the same data key.
+  bool dataMatch_;
+
+  ///@name Cached rows
+  //@{
+  /// Number of cone approximation cuts, they are the first rows.
+  int numConeCuts_;
+  /// Start of each row in index_ and value_, size is number of rows + 1.
+  std::vector<CoinBigIndex> start_;
+  /// Column indices of row coefficients.
+  std::vector<int> index_;
+  /// Row coefficients.
+  std::vector<double> value_;
+  /// Row lower bounds.
+  std::vector<double> lb_;
+  /// Row upper bounds.
+  std::vector<double> ub_;
+  //@}
+
+  /// Root basis, NULL if not cached.
+  CoinWarmStartBasis * basis_;
+
+  /// Cache file name.
+  std::string fileName() const;
+
+public:
+  ///@name Constructor and Destructor.
+  //@{
+  /// Constructor, creates an unused cache.
+  DcoRootCache();
+  /// Destructor.
+  ~DcoRootCache();
+  //@}
+
+  ///@name Cache operations
+  //@{
+  /// Set cache directory and instance keys. Empty directory disables the
+  /// cache.
+  void setup(std::string const & dir, std::size_t structureKey,
+             std::size_t dataKey);
+  /// True if the cache is used.
+  bool enabled() const { return !dir_.empty(); }
+  /// Load the cache file of the instance. Returns true if a file with the
+  /// same structure key is found.
+  bool load();
+  /// Save rows of the solver starting from firstRow and the basis. First
+  /// numConeCuts of these rows are cone approximation cuts. Returns true on
+  /// success.
+  bool save(OsiSolverInterface const * solver, int firstRow,
+            int numConeCuts);
+  /// Add cached rows to solver, only cone approximation cuts unless data
+  /// keys match. Sets cached basis when all rows are added. Returns number
+  /// of rows added.
+  int apply(OsiSolverInterface * solver) const;
+  //@}
+
+  ///@name Querry cache
+  //@{
+  /// True if the loaded file has the same data key.
+  bool dataMatch() const { return dataMatch_; }
+  /// Number of cached cone approximation cuts.
+  int numConeCuts() const { return numConeCuts_; }
+  /// Number of cached rows.
+  int numRows() const { return static_cast<int>(lb_.size()); }
+  //@}
+
+private:
+  /// Disable copy constructor.
+  DcoRootCache(DcoRootCache const & other);
+  /// Disable copy assignment operator.
+  DcoRootCache & operator=(DcoRootCache const & rhs);
+};
+
+#endif
@@ -0,0 +1,89 @@
+/*===========================================================================*
+ * This file is part of the Discrete Conic Optimization (DisCO) Solver.      *
+ *                                                                           *
+ * DisCO is distributed under the Eclipse Public License as part of the      *
+ * COIN-OR repository (http://www.coin-or.org).                              *
+ *                                                                           *
+ * Authors:                                                                  *
+ *          Aykut Bulut, Lehigh University                                   *
+ *          Yan Xu, Lehigh University                                        *
+ *          Ted Ralphs, Lehigh University                                    *
+ *                                                                           *
+ * Copyright (C) 2001-2018, Lehigh University, Aykut Bulut, Yan Xu, and      *
+ *                          Ted Ralphs.                                      *
+ * All Rights Reserved.                                                      *
+ *===========================================================================*/
+
+
+#include "DcoSlabAllocator.hpp"
+
+#include <new>
+
+DcoSlabAllocator::DcoSlabAllocator(char const * name,
+                                   std::size_t objectSize,
+                                   int objectsPerChunk) {
+  name_ = name;
+  // round up to pointer alignment, free objects store a pointer.
+  std::size_t align = sizeof(double) > sizeof(void*) ?
+    sizeof(double) : sizeof(void*);
+  objectSize_ = ((objectSize + align - 1)/align)*align;
+  objectsPerChunk_ = objectsPerChunk;
+  freeList_ = NULL;
+  numFresh_ = 0;
+  numAlloc_ = 0;
+  numReuse_ = 0;
+  numLive_ = 0;
+  peakLive_ = 0;
+}
+
+DcoSlabAllocator::~DcoSlabAllocator() {
+  for (unsigned int i=0; i<chunks_.size(); ++i) {
+    ::operator delete(chunks_[i]);
+  }
+  chunks_.clear();
+}
+
+void * DcoSlabAllocator::allocate(std::size_t size) {
+  if (size>objectSize_) {
+    return ::operator new(size);
+  }
+  void * ptr;
+  if (freeList_) {
+    ptr = freeList_;
+    freeList_ = *static_cast<void**>(freeList_);
+    numReuse_++;
+  }
+  else {
+    if (numFresh_==0) {
+      chunks_.push_back(static_cast<char*>
+                        (::operator new(objectSize_*objectsPerChunk_)));
+      numFresh_ = objectsPerChunk_;
+    }
+    numFresh_--;
+    ptr = chunks_.back() + objectSize_*numFresh_;
+  }
+  numAlloc_++;
+  numLive_++;
+  if (numLive_>peakLive_) {
+    peakLive_ = numLive_;
+  }
+  return ptr;
+}
+
+void DcoSlabAllocator::deallocate(void * ptr, std::size_t size) {
+  if (ptr==NULL) {
+    return;
+  }
+  if (size>objectSize_) {
+    ::operator delete(ptr);
+    return;
+  }
+  *static_cast<void**>(ptr) = freeList_;
+  freeList_ = ptr;
+  numLive_--;
+}
+
+long long int DcoSlabAllocator::chunkBytes() const {
+  return static_cast<long long int>(objectSize_)*objectsPerChunk_*
+    static_cast<long long int>(chunks_.size());
+}
@@ -0,0 +1,107 @@
+/*===========================================================================*
+ * This file is part of the Discrete Conic Optimization (DisCO) Solver.      *
+ *                                                                           *
+ * DisCO is distributed under the Eclipse Public License as part of the      *
+ * COIN-OR repository (http://www.coin-or.org).                              *
+ *                                                                           *
+ * Authors:                                                                  *
+ *          Aykut Bulut, Lehigh University                                   *
+ *          Yan Xu, Lehigh University                                        *
+ *          Ted Ralphs, Lehigh University                                    *
+ *                                                                           *
+ * Copyright (C) 2001-2018, Lehigh University, Aykut Bulut, Yan Xu, and      *
+ *                          Ted Ralphs.                                      *
+ * All Rights Reserved.                                                      *
+ *===========================================================================*/
+
+
+#ifndef DcoSlabAllocator_hpp_
+#define DcoSlabAllocator_hpp_
+
+#include <cstddef>
+#include <vector>
+
+/*!
+  Allocates fixed size objects from large chunks of memory.
+
+  Tree nodes, node descriptions and warm starts are created and deleted in
+  large numbers during search, one at a time. DcoSlabAllocator serves them
+  from chunks of #objectsPerChunk objects and keeps freed ones in a free
+  list to reuse, so the system allocator is called once per chunk.
+
+  Chunks are given back to the system when the allocator is destroyed.
+  Classes using it keep a static instance and overload operator new and
+  operator delete. Requests of a different size (derived classes) fall back
+  to the global operators.
+
+  The allocator is not thread safe and must not be used inside OpenMP
+  regions. Tree nodes, node descriptions and warm starts are only created
+  and deleted by the search thread. The parallel regions in
+  DcoTreeNode::generateConstraints(), DcoModel::approximateCones() and
+  DcoBranchStrategyStrong::createCandBranchObjects() work on solver clones
+  and cut containers only.
+*/
+
+class DcoSlabAllocator {
+  /// Name used in statistics.
+  char const * name_;
+  /// Size of an object, at least size of a pointer.
+  std::size_t objectSize_;
+  /// Number of objects in a chunk.
+  int objectsPerChunk_;
+  /// Chunks allocated.
+  std::vector<char*> chunks_;
+  /// Head of free list, free objects store pointer to the next one.
+  void * freeList_;
+  /// Number of objects not used yet in the last chunk.
+  int numFresh_;
+  /// Number of allocations.
+  long long int numAlloc_;
+  /// Number of allocations served from the free list.
+  long long int numReuse_;
+  /// Number of objects in use.
+  int numLive_;
+  /// Maximum number of objects in use.
+  int peakLive_;
+public:
+  ///@name Constructor and Destructor.
+  //@{
+  /// Constructor.
+  DcoSlabAllocator(char const * name, std::size_t objectSize,
+                   int objectsPerChunk);
+  /// Destructor, frees all chunks.
+  ~DcoSlabAllocator();
+  //@}
+
+  ///@name Allocation
+  //@{
+  /// Allocate memory for an object of given size.
+  void * allocate(std::size_t size);
+  /// Free memory of an object of given size.
+  void deallocate(void * ptr, std::size_t size);
+  //@}
+
+  ///@name Statistics
+  //@{
+  /// Name of the allocator.
+  char const * name() const { return name_; }
+  /// Number of allocations.
+  long long int numAlloc() const { return numAlloc_; }
+  /// Number of allocations served from the free list.
+  long long int numReuse() const { return numReuse_; }
+  /// Number of chunks allocated.
+  int numChunks() const { return static_cast<int>(chunks_.size()); }
+  /// Bytes allocated in chunks.
+  long long int chunkBytes() const;
+  /// Maximum number of objects in use.
+  int peakLive() const { return peakLive_; }
+  //@}
+
+private:
+  /// Disable copy constructor.
+  DcoSlabAllocator(DcoSlabAllocator const & other);
+  /// Disable copy assignment operator.
+  DcoSlabAllocator & operator=(DcoSlabAllocator const & rhs);
+};
+
+#endif
@@ -16,6 +16,7 @@
 
 
 // CoinUtils headers
+#include <CoinTime.hpp>
 #include "CoinUtility.hpp"
 
 // Osi headers
@@ -32,6 +33,7 @@
 #include "DcoConGenerator.hpp"
 #include "DcoSolution.hpp"
 #include "DcoBranchObject.hpp"
+#include "DcoBranchStrategyPseudo.hpp"
 #include "DcoHeuristic.hpp"
 #include "DcoHeurRounding.hpp"
 
@@ -53,6 +55,21 @@ struct Bound {
   SparseVector upper;
 };
 
+// tree nodes are created and deleted one at a time during search.
+static DcoSlabAllocator nodeAllocator("Tree node", sizeof(DcoTreeNode), 1024);
+
+void * DcoTreeNode::operator new(std::size_t size) {
+  return nodeAllocator.allocate(size);
+}
+
+void DcoTreeNode::operator delete(void * ptr, std::size_t size) {
+  nodeAllocator.deallocate(ptr, size);
+}
+
+DcoSlabAllocator const & DcoTreeNode::allocator() {
+  return nodeAllocator;
+}
+
 
 DcoTreeNode::DcoTreeNode() {
   desc_ = NULL;
@@ -88,6 +105,10 @@ DcoTreeNode::DcoTreeNode(AlpsNodeDesc *& desc) : BcpsTreeNode() {
 }
 
 DcoTreeNode::~DcoTreeNode() {
+  if (explicit_ && broker_) {
+    DcoModel * model = dynamic_cast<DcoModel*>(broker_->getModel());
+    model->removeExplicitNode(this);
+  }
 }
 
 // create tree node from given description
@@ -138,153 +159,300 @@ void DcoTreeNode::convertToExplicit() {
     << CoinMessageEol;
   // end of debug stuff
 
-  explicit_ = 1;
-
-  int num_cols = model->solver()->getNumCols();
-  // this will keep bound information, lower and upper
-  Bound hard_bound;
-  // ownership is transferred to Bcps, no need to free.
-  hard_bound.lower.ind = new int[num_cols];
-  hard_bound.lower.val = new double[num_cols];
-  hard_bound.upper.ind = new int[num_cols];
-  hard_bound.upper.val = new double[num_cols];
-  std::fill_n(hard_bound.lower.val, num_cols, ALPS_DBL_MAX);
-  std::fill_n(hard_bound.upper.val, num_cols, -ALPS_DBL_MAX);
-
-  Bound soft_bound;
-  // ownership is transferred to Bcps, no need to free.
-  soft_bound.lower.ind = new int[num_cols];
-  soft_bound.lower.val = new double[num_cols];
-  soft_bound.upper.ind = new int[num_cols];
-  soft_bound.upper.val = new double[num_cols];
-  std::fill_n(soft_bound.lower.val, num_cols, ALPS_DBL_MAX);
-  std::fill_n(soft_bound.upper.val, num_cols, -ALPS_DBL_MAX);
+  //--------------------------------------------------
+  // Travel back to an explicit node and collect bounds of this node. Store
+  // the ones that differ from the original problem, so explicit nodes are
+  // as sparse as the relative ones.
+  //--------------------------------------------------
+  int num_cols = model->getNumCoreVariables();
+  double * lb = new double[num_cols];
+  double * ub = new double[num_cols];
+  collectBounds(lb, ub);
+  assignBounds(lb, ub, model->colLB(), model->colUB());
+  delete[] lb;
+  delete[] ub;
+  // store inherited constraints as well.
+  if (parent_) {
+    std::vector<DcoConstraint*> inherited;
+    dynamic_cast<DcoTreeNode*>(parent_)->collectCons(inherited);
+    node_desc->makeConsExplicit(inherited);
+  }
 
-  for (int k = 0; k < num_cols; ++k) {
-    hard_bound.lower.ind[k] = k;
-    hard_bound.upper.ind[k] = k;
-    soft_bound.lower.ind[k] = k;
-    soft_bound.upper.ind[k] = k;
+  explicit_ = 1;
+  node_desc->setDiffDepth(0);
+  node_desc->setDiffBytes(0);
+  if (parent_) {
+    model->addExplicitNode(this, node_desc->boundBytes());
   }
+}
 
-  //--------------------------------------------------
-  // Travel back to a full node, then collect diff (add/rem col/row,
-  // hard/soft col/row bounds) from the node full to this node.
-  //--------------------------------------------------------
+void DcoTreeNode::snapshotDesc() {
+  DcoNodeDesc * node_desc = dynamic_cast<DcoNodeDesc*>(getDesc());
+  DcoModel * model = dynamic_cast<DcoModel*>(broker_->getModel());
+  // installed bounds are combination of hard and soft bounds.
+  assignBounds(model->installedColLB(), model->installedColUB(),
+               model->colLB(), model->colUB());
+  // constraints inherited from ancestors are owned by their descriptions,
+  // store copies.
+  if (parent_) {
+    std::vector<DcoConstraint*> inherited;
+    dynamic_cast<DcoTreeNode*>(parent_)->collectCons(inherited);
+    node_desc->makeConsExplicit(inherited);
+  }
+  explicit_ = 1;
+  node_desc->setDiffDepth(0);
+  node_desc->setDiffBytes(0);
+  model->addSnapshot(node_desc->boundBytes());
+}
 
-  AlpsTreeNode * parent = parent_;
+int DcoTreeNode::collectBounds(double * lb, double * ub) const {
+  DcoModel * model = dynamic_cast<DcoModel*>(broker_->getModel());
+  int num_cols = model->getNumCoreVariables();
+  CoinDisjointCopyN(model->colLB(), num_cols, lb);
+  CoinDisjointCopyN(model->colUB(), num_cols, ub);
+
+  std::vector<AlpsTreeNode const *> leafToRootPath;
+  AlpsTreeNode const * node = this;
+  while (node) {
+    leafToRootPath.push_back(node);
+    if (node->getExplicit()) {
+      break;
+    }
+    node = node->getParent();
+  }
 
-  std::vector<AlpsTreeNode*> leafToRootPath;
-  leafToRootPath.push_back(this);
+  // Same as DcoModel::applyInstalled(), bounds only get tighter.
+  int num_cons = 0;
+  for (int i=static_cast<int>(leafToRootPath.size())-1; i>-1; --i) {
+    DcoNodeDesc * curr = dynamic_cast<DcoNodeDesc*>
+      (leafToRootPath[i]->getDesc());
+    BcpsObjectListMod * vars = curr->getVars();
+    for (int k=0; k<vars->lbHard.numModify; ++k) {
+      int index = vars->lbHard.posModify[k];
+      lb[index] = CoinMax(lb[index], vars->lbHard.entries[k]);
+    }
+    for (int k=0; k<vars->ubHard.numModify; ++k) {
+      int index = vars->ubHard.posModify[k];
+      ub[index] = CoinMin(ub[index], vars->ubHard.entries[k]);
+    }
+    for (int k=0; k<vars->lbSoft.numModify; ++k) {
+      int index = vars->lbSoft.posModify[k];
+      lb[index] = CoinMax(lb[index], vars->lbSoft.entries[k]);
+    }
+    for (int k=0; k<vars->ubSoft.numModify; ++k) {
+      int index = vars->ubSoft.posModify[k];
+      ub[index] = CoinMin(ub[index], vars->ubSoft.entries[k]);
+    }
+    num_cons += curr->getCons()->numAdd - curr->getCons()->numRemove;
+  }
+  return num_cons;
+}
 
-  while(parent) {
-    leafToRootPath.push_back(parent);
-    if (parent->getExplicit()) {
-      // Reach an explicit node, then stop.
+void DcoTreeNode::collectCons(std::vector<DcoConstraint*> & cons) const {
+  cons.clear();
+  std::vector<AlpsTreeNode const *> leafToRootPath;
+  AlpsTreeNode const * node = this;
+  while (node) {
+    leafToRootPath.push_back(node);
+    if (node->getExplicit()) {
       break;
     }
-    else {
-      parent = parent->getParent();
+    node = node->getParent();
+  }
+  // Same as DcoModel::applyInstalled(), add constraints of the node then
+  // remove the ones it deletes.
+  for (int i=static_cast<int>(leafToRootPath.size())-1; i>-1; --i) {
+    BcpsObjectListMod * mod = dynamic_cast<DcoNodeDesc*>
+      (leafToRootPath[i]->getDesc())->getCons();
+    for (int k=0; k<mod->numAdd; ++k) {
+      cons.push_back(dynamic_cast<DcoConstraint*>(mod->objects[k]));
+    }
+    if (mod->numRemove>0) {
+      int num_cons = static_cast<int>(cons.size());
+      std::vector<char> removed(num_cons, 0);
+      for (int k=0; k<mod->numRemove; ++k) {
+        removed[mod->posRemove[k]] = 1;
+      }
+      int num_kept = 0;
+      for (int k=0; k<num_cons; ++k) {
+        if (!removed[k]) {
+          cons[num_kept++] = cons[k];
+        }
+      }
+      cons.resize(num_kept);
     }
   }
+}
 
-  //------------------------------------------------------
-  // Travel back from this node to the explicit node to
-  // collect full description.
-  //------------------------------------------------------
-  for(int i=static_cast<int> (leafToRootPath.size()-1); i>-1; --i) {
-    DcoNodeDesc * curr = dynamic_cast<DcoNodeDesc*>((leafToRootPath.at(i))->
-                                           getDesc());
-    //--------------------------------------
-    // Full variable hard bounds.
-    //--------------------------------------
-    int numModify = curr->getVars()->lbHard.numModify;
-    for (int k=0; k<numModify; ++k) {
-      int index = curr->getVars()->lbHard.posModify[k];
-      double value = curr->getVars()->lbHard.entries[k];
-      hard_bound.lower.val[index] = value;
+void DcoTreeNode::assignBounds(double const * lb, double const * ub,
+                               double const * baseLB,
+                               double const * baseUB) {
+  DcoModel * model = dynamic_cast<DcoModel*>(broker_->getModel());
+  int num_cols = model->getNumCoreVariables();
+  int num_lower = 0;
+  int num_upper = 0;
+  for (int k=0; k<num_cols; ++k) {
+    if (lb[k]>baseLB[k]) {
+      num_lower++;
     }
-
-    numModify = curr->getVars()->ubHard.numModify;
-    for (int k=0; k<numModify; ++k) {
-      int index = curr->getVars()->ubHard.posModify[k];
-      double value = curr->getVars()->ubHard.entries[k];
-      hard_bound.upper.val[index] = value;
+    if (ub[k]<baseUB[k]) {
+      num_upper++;
     }
-
-    //--------------------------------------
-    // Full variable soft bounds.
-    //--------------------------------------
-    numModify = curr->getVars()->lbSoft.numModify;
-    for (int k=0; k<numModify; ++k) {
-      int index = curr->getVars()->lbSoft.posModify[k];
-      double value = curr->getVars()->lbSoft.entries[k];
-      soft_bound.lower.val[index] = value;
+  }
+  // ownership is transferred to Bcps, no need to free.
+  Bound hard_bound;
+  hard_bound.lower.ind = new int[num_lower];
+  hard_bound.lower.val = new double[num_lower];
+  hard_bound.upper.ind = new int[num_upper];
+  hard_bound.upper.val = new double[num_upper];
+  num_lower = 0;
+  num_upper = 0;
+  for (int k=0; k<num_cols; ++k) {
+    if (lb[k]>baseLB[k]) {
+      hard_bound.lower.ind[num_lower] = k;
+      hard_bound.lower.val[num_lower++] = lb[k];
     }
-
-    numModify = curr->getVars()->ubSoft.numModify;
-    for (int k=0; k<numModify; ++k) {
-      int index = curr->getVars()->ubSoft.posModify[k];
-      double value = curr->getVars()->ubSoft.entries[k];
-      soft_bound.upper.val[index] = value;
+    if (ub[k]<baseUB[k]) {
+      hard_bound.upper.ind[num_upper] = k;
+      hard_bound.upper.val[num_upper++] = ub[k];
     }
-
-
-
-  } // EOF for (path)
-
-  //------------------------------------------
-  // Record hard variable bounds. FULL set.
-  //------------------------------------------
-  node_desc->assignVarHardBound(num_cols,
+  }
+  DcoNodeDesc * node_desc = getDesc();
+  node_desc->assignVarHardBound(num_lower,
                                 hard_bound.lower.ind,
                                 hard_bound.lower.val,
-                                num_cols,
+                                num_upper,
                                 hard_bound.upper.ind,
                                 hard_bound.upper.val);
-
-  //------------------------------------------
-  // Recode soft variable bound. Modified.
-  //------------------------------------------
-  int numSoftVarLowers=0;
-  int numSoftVarUppers=0;
-  for (int k=0; k<num_cols; ++k) {
-    if (soft_bound.lower.val[k] < ALPS_BND_MAX) {
-      soft_bound.lower.ind[numSoftVarLowers] = k;
-      soft_bound.lower.val[numSoftVarLowers++] = soft_bound.lower.val[k];
-    }
-    if (soft_bound.upper.val[k] > -ALPS_BND_MAX) {
-      soft_bound.upper.ind[numSoftVarUppers] = k;
-      soft_bound.upper.val[numSoftVarUppers++] = soft_bound.upper.val[k];
-    }
-  }
-  // Assign it anyway so to delete memory(fVarSoftLBInd,etc.)
-  node_desc->assignVarSoftBound(numSoftVarLowers,
+  // soft bounds are included in hard bounds, remove them.
+  Bound soft_bound;
+  soft_bound.lower.ind = NULL;
+  soft_bound.lower.val = NULL;
+  soft_bound.upper.ind = NULL;
+  soft_bound.upper.val = NULL;
+  node_desc->assignVarSoftBound(0,
                                 soft_bound.lower.ind,
                                 soft_bound.lower.val,
-                                numSoftVarUppers,
+                                0,
                                 soft_bound.upper.ind,
                                 soft_bound.upper.val);
+}
 
-  //--------------------------------------------------
-  // Clear path vector.
-  //--------------------------------------------------
-  leafToRootPath.clear();
-  assert(leafToRootPath.size() == 0);
+void DcoTreeNode::convertToRelative() {
+  if (!explicit_ || parent_==NULL) {
+    return;
+  }
+  DcoNodeDesc * node_desc = getDesc();
+  DcoModel * model = dynamic_cast<DcoModel*>(broker_->getModel());
+  int num_cols = model->getNumCoreVariables();
+
+  double * lb = new double[num_cols];
+  double * ub = new double[num_cols];
+  double * parent_lb = new double[num_cols];
+  double * parent_ub = new double[num_cols];
+  collectBounds(lb, ub);
+  DcoTreeNode * parent = dynamic_cast<DcoTreeNode*>(parent_);
+  int num_parent_cons = parent->collectBounds(parent_lb, parent_ub);
+
+  // Positions of removed constraints in this node and its descendants are
+  // relative to the constraints of this node. They would be wrong if the
+  // parent has constraints. Bounds of this node should be tighter than the
+  // bounds of the parent, looser bounds can not be stored as a diff.
+  bool convert = (num_parent_cons==0);
+  for (int k=0; k<num_cols && convert; ++k) {
+    if (lb[k]<parent_lb[k] || ub[k]>parent_ub[k]) {
+      convert = false;
+    }
+  }
 
+  if (convert) {
+    assignBounds(lb, ub, parent_lb, parent_ub);
+    model->removeExplicitNode(this);
+    explicit_ = 0;
+    DcoNodeDesc * parent_desc = parent->getDesc();
+    if (parent->getExplicit()) {
+      node_desc->setDiffDepth(1);
+      node_desc->setDiffBytes(node_desc->boundBytes());
+    }
+    else {
+      node_desc->setDiffDepth(parent_desc->getDiffDepth()+1);
+      node_desc->setDiffBytes(parent_desc->getDiffBytes() +
+                              node_desc->boundBytes());
+    }
+    // descendants are now farther from an explicit node, so that they are
+    // still snapshot in time.
+    shiftDescendantDiff(node_desc->getDiffDepth(),
+                        node_desc->getDiffBytes());
+  }
+
+  delete[] lb;
+  delete[] ub;
+  delete[] parent_lb;
+  delete[] parent_ub;
 }
 
-void DcoTreeNode::convertToRelative() {
-  //DcoNodeDesc * node_desc = dynamic_cast<DcoNodeDesc*>(getDesc());
-  DcoModel * model = dynamic_cast<DcoModel*>(broker()->getModel());
-  CoinMessageHandler * message_handler = model->dcoMessageHandler_;
-  CoinMessages * messages = model->dcoMessages_;
-  message_handler->message(DISCO_NOT_IMPLEMENTED, *messages)
-    << broker()->getProcRank()
-    << __FILE__ << __LINE__ << CoinMessageEol;
-  throw std::exception();
+DcoTreeNode * DcoTreeNode::createExplicitCopy() const {
+  DcoModel * model = dynamic_cast<DcoModel*>(broker_->getModel());
+  DcoNodeDesc * node_desc = getDesc();
+  DcoNodeDesc * desc = new DcoNodeDesc(model);
+  desc->setBroker(broker_);
+  desc->setBranchedDir(node_desc->getBranchedDir());
+  desc->setBranchedInd(node_desc->getBranchedInd());
+  desc->setBranchedVal(node_desc->getBranchedVal());
+  desc->shareBasis(node_desc->getWarmStart());
+  // copy of the constraints inherited from ancestors and added by this node
+  std::vector<DcoConstraint*> cons;
+  collectCons(cons);
+  std::vector<BcpsObject*> objects;
+  for (unsigned int k=0; k<cons.size(); ++k) {
+    DcoLinearConstraint const * con =
+      dynamic_cast<DcoLinearConstraint const *>(cons[k]);
+    assert(con);
+    objects.push_back(new DcoLinearConstraint(*con));
+  }
+  if (!objects.empty()) {
+    desc->appendCons(static_cast<int>(objects.size()), &objects[0]);
+  }
+  AlpsNodeDesc * alps_desc = desc;
+  DcoTreeNode * copy = new DcoTreeNode(alps_desc);
+  copy->setBroker(broker_);
+  int num_cols = model->getNumCoreVariables();
+  double * lb = new double[num_cols];
+  double * ub = new double[num_cols];
+  collectBounds(lb, ub);
+  copy->assignBounds(lb, ub, model->colLB(), model->colUB());
+  delete[] lb;
+  delete[] ub;
+  copy->setIndex(index_);
+  copy->setDepth(depth_);
+  copy->setParentIndex(getParentIndex());
+  copy->quality_ = quality_;
+  copy->solEstimate_ = solEstimate_;
+  // branch object is not copied, receiver evaluates pregnant nodes again.
+  copy->setStatus(isPregnant() ? AlpsNodeStatusEvaluated : getStatus());
+  copy->setExplicit(1);
+  return copy;
 }
 
+void DcoTreeNode::shiftDescendantDiff(int depth, int bytes) {
+  std::vector<AlpsTreeNode*> stack;
+  for (int i=0; i<getNumChildren(); ++i) {
+    stack.push_back(getChild(i));
+  }
+  while (!stack.empty()) {
+    AlpsTreeNode * node = stack.back();
+    stack.pop_back();
+    if (node==NULL or node->getExplicit()) {
+      continue;
+    }
+    DcoNodeDesc * desc = dynamic_cast<DcoNodeDesc*>(node->getDesc());
+    desc->setDiffDepth(desc->getDiffDepth()+depth);
+    desc->setDiffBytes(desc->getDiffBytes()+bytes);
+    for (int i=0; i<node->getNumChildren(); ++i) {
+      stack.push_back(node->getChild(i));
+    }
+  }
+}
 
 // todo(aykut) I feel like branchConstraintPrice function and
 // generateConstraint function should have more communication, since decisions
@@ -301,24 +469,94 @@ int DcoTreeNode::generateConstraints(BcpsConstraintPool * conPool, int type) {
   CoinMessageHandler * message_handler = disco_model->dcoMessageHandler_;
   //CoinMessages * messages = disco_model->dcoMessages_;
 
+  // separate cuts of the global pool of the requested types, they compete
+  // with the generated ones in cut selection.
+  if (disco_model->dcoPar()->entry(DcoParams::shareConstraints) and
+      disco_model->cutPool().size()) {
+    double cone_tol = disco_model->dcoPar()->entry(DcoParams::coneTol);
+    double int_tol = disco_model->dcoPar()->entry(DcoParams::integerTol);
+    double const * sol = disco_model->solver()->getColSolution();
+    int num_sep = disco_model->cutPool().separate(sol, type, cone_tol,
+                                                  int_tol, *conPool);
+    if (num_sep) {
+      std::stringstream debug_msg;
+      debug_msg << "[" << broker()->getProcRank() << "] Separated "
+                << num_sep << " cuts from global cut pool.";
+      message_handler->message(0, "Dco", debug_msg.str().c_str(),
+                               'G', DISCO_DLOG_CUT)
+        << CoinMessageEol;
+    }
+  }
+
   std::map<DcoConstraintType, DcoConGenerator*>::iterator it;
   std::map<DcoConstraintType, DcoConGenerator*> con_generators = disco_model->conGenerators();
+  // generators to call, in the order of con_generators
+  std::vector<DcoConGenerator*> gens;
   for (it=con_generators.begin(); it != con_generators.end(); ++it) {
     bool do_use = false;
     DcoConGenerator * cg = it->second;
     // decide whether we should use this cut generator with respect to the
     // specified cut strategy
     decide_using_cg(do_use, cg, type);
-    if (!do_use) {
-      // jump to the next geenrator if we will not use this one.
-      continue;
+    if (do_use) {
+      gens.push_back(cg);
     }
+  }
+  int num_gens = static_cast<int>(gens.size());
+  // constraints generated concurrently, NULL if generator is called below
+  std::vector<BcpsConstraintPool*> gen_pools(num_gens,
+                                             static_cast<BcpsConstraintPool*>
+                                             (NULL));
+  // wall clock time of each generator. CPU time is per process, it can not
+  // be used for generators running concurrently, so it is not used for any.
+  std::vector<double> gen_time(num_gens, 0.0);
+#ifdef _OPENMP
+  int num_threads = disco_model->dcoPar()->entry(DcoParams::cutGenThreads);
+  if (num_threads>1 and num_gens>1) {
+    // cache cone violations, generators only read them.
+    disco_model->checkConeFeasibility();
+    // each generator gets a private snapshot of the solver and a private
+    // constraint pool.
+    std::vector<OsiSolverInterface*> snapshots(num_gens);
+    for (int g=0; g<num_gens; ++g) {
+      snapshots[g] = disco_model->solver()->clone(true);
+      gens[g]->setSolver(snapshots[g]);
+      gen_pools[g] = new BcpsConstraintPool();
+    }
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+    for (int g=0; g<num_gens; ++g) {
+      double start_time = CoinGetTimeOfDay();
+      gens[g]->generateConstraints(*gen_pools[g]);
+      gen_time[g] = CoinGetTimeOfDay() - start_time;
+    }
+    for (int g=0; g<num_gens; ++g) {
+      gens[g]->setSolver(NULL);
+      delete snapshots[g];
+    }
+  }
+#endif
+  // call generators that did not run concurrently and merge constraints in
+  // generator order.
+  for (int g=0; g<num_gens; ++g) {
+    DcoConGenerator * cg = gens[g];
     int pre_num_cons = conPool->getNumConstraints();
-    double start_time = CoinCpuTime();
-    // Call constraint generator
-    //bool must_resolve = cg->generateConstraints(*conPool);
-    cg->generateConstraints(*conPool);
-    double cut_time = CoinCpuTime() - start_time;
+    if (gen_pools[g]) {
+      int num_cons = gen_pools[g]->getNumConstraints();
+      for (int k=0; k<num_cons; ++k) {
+        conPool->addConstraint(gen_pools[g]->getConstraint(k));
+      }
+      // constraints are owned by conPool now.
+      gen_pools[g]->clear();
+      delete gen_pools[g];
+    }
+    else {
+      double start_time = CoinGetTimeOfDay();
+      // Call constraint generator
+      //bool must_resolve = cg->generateConstraints(*conPool);
+      cg->generateConstraints(*conPool);
+      gen_time[g] = CoinGetTimeOfDay() - start_time;
+    }
+    double cut_time = gen_time[g];
     // Statistics
     cg->stats().addTime(cut_time);
     cg->stats().addNumCalls(1);
@@ -329,6 +567,13 @@ int DcoTreeNode::generateConstraints(BcpsConstraintPool * conPool, int type) {
     else {
       cg->stats().addNumConsGenerated(num_cons_generated);
     }
+    // constraints valid for all nodes go to the global cut pool
+    std::vector<DcoLinearConstraint*>::const_iterator sit;
+    for (sit=cg->sharedConstraints().begin();
+         sit!=cg->sharedConstraints().end(); ++sit) {
+      disco_model->cutPool().addCut(*sit);
+    }
+    cg->clearShared();
 
     // debug msg
     std::stringstream debug_msg;
@@ -420,6 +665,7 @@ int DcoTreeNode::process(bool isRoot, bool rampUp) {
   DcoModel * model = dynamic_cast<DcoModel*>(broker()->getModel());
   CoinMessageHandler * message_handler = model->dcoMessageHandler_;
   CoinMessages * messages = model->dcoMessages_;
+  model->nodeTimer().beginNode(getIndex(), getDepth());
 
   // debug stuff
 #ifdef DISCO_DEBUG
@@ -507,12 +753,17 @@ int DcoTreeNode::boundingLoop(bool isRoot, bool rampUp) {
   bool genVariables = false;
   BcpsConstraintPool * constraintPool = new BcpsConstraintPool();
   BcpsVariablePool * variablePool = new BcpsVariablePool();
+  DcoNodeTimer & timer = model->nodeTimer();
+  timer.start(DcoNodePhaseInstall);
   installSubProblem();
+  timer.stop();
 
   while (keepBounding) {
     keepBounding = false;
     // solve subproblem corresponds to this node
+    timer.start(DcoNodePhaseBound);
     BcpsSubproblemStatus subproblem_status = bound();
+    timer.stop();
     // update number of iterations statistics
     model->addNumRelaxIterations();
     // update bcp statistics
@@ -543,16 +794,10 @@ int DcoTreeNode::boundingLoop(bool isRoot, bool rampUp) {
         (getStatus()==AlpsNodeStatusCandidate or
          getStatus()==AlpsNodeStatusEvaluated)) {
       double sum_inf = 0.0;
-      int num_inf = 0;
-      int const * relaxedCols = model->relaxedCols();
-      for (int i=0; i<model->numRelaxedCols(); ++i) {
-        int dir;
-        double infeas = dynamic_cast<DcoVariable*>
-          (model->getVariables()[relaxedCols[i]])->infeasibility(model, dir);
-        if (infeas!=0.0) {
-          num_inf++;
-        }
-        sum_inf += infeas;
+      model->checkIntegrality();
+      int num_inf = model->numInfRelaxed();
+      for (int i=0; i<num_inf; ++i) {
+        sum_inf += model->relaxedInfeas()[model->infRelaxed()[i]];
       }
       message_handler->message(DISCO_GRUMPY_MESSAGE_LONG, *messages)
         << broker()->getProcRank()
@@ -608,11 +853,15 @@ int DcoTreeNode::boundingLoop(bool isRoot, bool rampUp) {
     }
     // call heuristics to search for a solution
     if (bcpStats_.numBoundIter_==0) {
+      timer.start(DcoNodePhaseHeuristics);
       callHeuristics();
+      timer.stop();
     }
 #ifdef __OA__
     // update cut stats and clean if necessary
+    timer.start(DcoNodePhaseCheckCuts);
     checkCuts();
+    timer.stop();
 #endif
 
     // decide what to do
@@ -634,9 +883,13 @@ int DcoTreeNode::boundingLoop(bool isRoot, bool rampUp) {
       break;
     }
     else if (keepBounding and genConstraints) {
+      timer.start(DcoNodePhaseGenerateCons);
       generateConstraints(constraintPool, genConstraints);
+      timer.stop();
       // add constraints to the model
+      timer.start(DcoNodePhaseApplyCons);
       applyConstraints(constraintPool);
+      timer.stop();
       // clear constraint pool
       constraintPool->freeGuts();
       // set status to evaluated
@@ -657,7 +910,9 @@ int DcoTreeNode::boundingLoop(bool isRoot, bool rampUp) {
     else if (keepBounding==false and do_branch) {
       // branch
       BcpsBranchStrategy * branchStrategy = model->branchStrategy();
+      timer.start(DcoNodePhaseBranchCands);
       branchStrategy->createCandBranchObjects(this);
+      timer.stop();
       // prepare this node for branching, bookkeeping for differencing.
       // call pregnant setting routine
       processSetPregnant();
@@ -670,123 +925,80 @@ int DcoTreeNode::boundingLoop(bool isRoot, bool rampUp) {
     // increase iteration number
     bcpStats_.numBoundIter_++;
   }
+  // cuts marked for deletion stay if the node is not resolved
+  bcpStats_.purge_.clear();
+  if (isRoot) {
+    // root rows and basis can be reused by later runs
+    model->saveRootCache();
+  }
   delete constraintPool;
   delete variablePool;
   return AlpsReturnStatusOk;
 }
 
 //1. update cut statistics
-//2. remove inactive cuts
+//2. mark cuts that are inactive for too long, they are deleted before the
+//   next resolve by purgeCuts().
 void DcoTreeNode::checkCuts() {
   DcoModel * model = dynamic_cast<DcoModel*>(broker()->getModel());
-  //CoinMessageHandler * message_handler = model->dcoMessageHandler_;
-  //CoinMessages * messages = model->dcoMessages_;
   int origNumRows = model->getNumCoreLinearConstraints();
-  int initOAcuts = model->initOAcuts();
-  int solverNumRows = model->solver()->getNumRows();
-  int numCuts = solverNumRows - origNumRows;
+  int numCuts = model->solver()->getNumRows() - origNumRows;
+  BcpStats * st = &bcpStats_;
+  // new cuts start as active.
+  st->inactive_.resize(numCuts, 0);
+  st->purge_.clear();
   if (numCuts==0) {
     return;
   }
-  CoinWarmStartBasis * ws =
-    dynamic_cast<CoinWarmStartBasis*> (model->solver()->getWarmStart());
-  if (ws==NULL) {
-    // nothing to do if there is no warm start information
-    std::cerr << "Disco warning: No warm start object exists in solver. "
-              << "Unable to clean cuts." << std::endl;
-    return;
-  }
   double cutOaSlack = model->dcoPar()->entry(DcoParams::cutOaSlack2);
-  BcpStats * st = &bcpStats_;
-  // iterate over cuts and update inactivity statistics
-  std::list<int>::iterator curr = st->inactive_.begin();
+  int slackLimit = model->dcoPar()->entry(DcoParams::cutOaSlackLimit);
+  double const * lb = model->solver()->getRowLower() + origNumRows;
+  double const * ub = model->solver()->getRowUpper() + origNumRows;
+  double const * activity = model->solver()->getRowActivity() + origNumRows;
+  int * inactive = &st->inactive_[0];
+  // iterate over cuts and update inactivity statistics. A cut with
+  // positive slack is basic, so the basis is not needed.
   for (int i=0; i<numCuts; ++i) {
-
-      // double norm = 0.0;
-      // {
-      //   // compute norm of cut
-      //   CoinPackedMatrix const * mat = solver_->getMatrixByRow();
-      //   int start = mat->getVectorStarts()[i];
-      //   int size = mat->getVectorLengths()[i];
-      //   double const * value = mat->getElements() + start;
-      //   for (int j=0; j<size; ++j) {
-      //     norm += fabs(value[j]);
-      //   }
-      // }
-
-
-    double slack = model->solver()->getRowUpper()[origNumRows+i] - model->solver()->getRowActivity()[origNumRows+i];
-    // check whether ith cut is basic
-    if (ws->getArtifStatus(origNumRows+i) == CoinWarmStartBasis::basic &&
-        slack > cutOaSlack) {
-      // print activity
-      // std::cout << "activity: "
-      //           << slack
-      //           << std::endl;
-      // cut is inactive, update stats
-      if (curr==st->inactive_.end()) {
-        // no entry in the list for cut i, insert
-        st->inactive_.insert(curr, 1);
-      }
-      else {
-        // update entry of cut i
-        *curr += 1;
-        curr++;
-      }
-    }
-    else {
-      // cut is active
-      if (curr==st->inactive_.end()) {
-        // insert if there is no entry for cut i yet
-        st->inactive_.insert(curr, 0);
-      }
-      else {
-        // reset stat for cut i to 0
-        *curr = 0;
-        curr++;
-      }
+    double slack = CoinMin(ub[i]-activity[i], activity[i]-lb[i]);
+    inactive[i] = (slack > cutOaSlack) ? inactive[i]+1 : 0;
+    if (inactive[i] > slackLimit) {
+      st->purge_.push_back(i+origNumRows);
     }
   }
-  // iterate over cuts and remove the ones that are inactive for
-  // 3 or more iterations
-  //int slackLimit = model->dcoPar()->entry(DcoParams::cutOaSlackLimit);
-  {
-    std::list<int>::iterator curr = st->inactive_.begin();
-    //std::list<int>::iterator curr2 = st->generatorIndex_.begin();
-    int numDel = 0;
-    int * delInd = new int[numCuts];
-    int num_del_init_oa = 0;
-    for (int i=0; i<numCuts; ++i) {
-      if (*curr>3) {
-        delInd[numDel++] = i+origNumRows;
-        // check whether cut is an initial OA cut
-        if (i<initOAcuts) {
-          num_del_init_oa++;
-        }
-        // delete curr from inactivity_
-        curr = st->inactive_.erase(curr);
-        //curr2 = st->inactive_.erase(curr2);
-      }
-      else {
-        curr++;
-        //curr2++;
+}
+
+void DcoTreeNode::purgeCuts() {
+  BcpStats * st = &bcpStats_;
+  int numDel = static_cast<int>(st->purge_.size());
+  if (numDel==0) {
+    return;
+  }
+  DcoModel * model = dynamic_cast<DcoModel*>(broker()->getModel());
+  int origNumRows = model->getNumCoreLinearConstraints();
+  int initOAcuts = model->initOAcuts();
+  // remove statistics of deleted cuts, cuts added after checkCuts() are
+  // kept.
+  int numCuts = static_cast<int>(st->inactive_.size());
+  int num_del_init_oa = 0;
+  int numKept = 0;
+  int k = 0;
+  for (int i=0; i<numCuts; ++i) {
+    if (k<numDel and st->purge_[k]==i+origNumRows) {
+      k++;
+      // check whether cut is an initial OA cut
+      if (i<initOAcuts) {
+        num_del_init_oa++;
       }
+      continue;
     }
-    // delete cuts from solver
-    if (numDel) {
-      // std::cout << "node " << index_
-      //           << " iter: " << st->numBoundIter_
-      //           << " removed: " << numDel
-      //           << " remain: " << numCuts-numDel
-      //           << std::endl;
-      model->solver()->deleteRows(numDel, delInd);
-      // resolve to correct status
-      model->solver()->resolve();
-    }
-    delete[] delInd;
-    model->decreaseInitOAcuts(num_del_init_oa);
+    st->inactive_[numKept++] = st->inactive_[i];
   }
-  delete ws;
+  st->inactive_.resize(numKept);
+  model->solver()->deleteRows(numDel, &st->purge_[0]);
+  model->invalidateRowIndex();
+  model->removeSolverRows(numDel, &st->purge_[0]);
+  model->decreaseInitOAcuts(num_del_init_oa);
+  st->purge_.clear();
 }
 
 void DcoTreeNode::callHeuristics() {
@@ -863,8 +1075,12 @@ BcpsSubproblemStatus DcoTreeNode::bound() {
     message_handler->message(DISCO_NODE_UNEXPECTEDSTATUS, *messages)
       << static_cast<int>(node_status) << CoinMessageEol;
   }
+  // delete cuts marked in the last bounding iteration
+  purgeCuts();
   // solve problem loaded to the solver
   model->solver()->resolve();
+  model->invalidateIntegrality();
+  model->invalidateCones();
   if (model->solver()->isAbandoned()) {
     subproblem_status = BcpsSubproblemStatusAbandoned;
   }
@@ -917,6 +1133,14 @@ BcpsSubproblemStatus DcoTreeNode::bound() {
       << broker()->getProcRank()
       << CoinMessageEol;
   }
+  // infeasible children are pseudocost observations of their branch
+  if (subproblem_status==BcpsSubproblemStatusPrimalInfeasible) {
+    DcoBranchStrategyPseudo * pseudo =
+      dynamic_cast<DcoBranchStrategyPseudo*>(model->branchStrategy());
+    if (pseudo) {
+      pseudo->infeasibleChild(this);
+    }
+  }
   return subproblem_status;
 }
 
@@ -926,88 +1150,52 @@ int DcoTreeNode::installSubProblem() {
   //
   //======================================================
   // Restore subproblem:
-  //  1. Remove noncore columns and rows
-  //  2. Travel back to root and correct differencing to
-  //     full column/row bounds into model->startXXX
-  //  3. Set col bounds
-  //  4. Set row bounds (is this necessary?)
-  //  5. Add contraints except cores
-  //  6. Add variables except cores
-  //  7. Set basis (should not need modify)
+  //  1. Travel back to the common ancestor of this node and the subproblem
+  //     installed in the solver, or to an explicit node if there is none.
+  //  2. Undo changes of installed nodes below the common ancestor.
+  //  3. Apply changes of nodes from the common ancestor to this node.
+  //  4. Push changed col bounds and rows to solver. Set row bounds (is this
+  //     necessary?). Add variables except cores.
+  //  5. Set basis (should not need modify)
   //======================================================
   AlpsReturnStatus status = AlpsReturnStatusOk;
   DcoModel * model = dynamic_cast<DcoModel*>(broker_->getModel());
-  CoinMessageHandler * message_handler = model->dcoMessageHandler_;
-  CoinMessages * messages = model->dcoMessages_;
   DcoNodeDesc * desc = dynamic_cast<DcoNodeDesc*>(getDesc());
-  // get number of columns and rows
-  int numCoreCols = model->getNumCoreVariables();
-  int numCoreLinearRows = model->getNumCoreLinearConstraints();
-  //int numCoreConicRows = model->getNumCoreConicConstraints();
-  // get number of columns and rows stored in the solver
-  //int numSolverCols = model->solver()->getNumCols();
-  // solver rows are all linear, for both Osi and OsiConic.
-  int numSolverRows = model->solver()->getNumRows();
-  int initOAcuts = model->initOAcuts();
-
-  // 1. Remove noncore columns and rows
-  // 1.1 Remove non-core rows from solver, i.e. cuts
-
-  // we want to remove all cuts that are not added initialy after approximating
-  // cones in #DcoModel::approximateCones(). Approximation cuts that are added
-  // initially comes first in the order in solver rows.
-  int numDelRows = numSolverRows - numCoreLinearRows - initOAcuts;
-#ifndef __COLA__
-  if (numDelRows > 0) {
-    int * indices = new int[numDelRows];
-    if (indices==NULL) {
-      message_handler->message(DISCO_OUT_OF_MEMORY, *messages)
-        << broker()->getProcRank()
-        << __FILE__ << __LINE__ << CoinMessageEol;
-      throw CoinError("Out of memory", "installSubProblem", "DcoTreeNode");
-    }
-    for (int i=0; i<numDelRows; ++i) {
-      indices[i] = numCoreLinearRows + initOAcuts + i;
-    }
-    model->solver()->deleteRows(numDelRows, indices);
-    delete[] indices;
-    indices = NULL;
-  }
-#endif
-  // 1.1 Remove non-core columns from solver
-  // End of 1.
-
-  //  2. Travel back to root and correct differencing to full column/row bounds
-  // into model->startXXX
-  //--------------------------------------------------------
-  // Travel back to a full node, then collect diff (add/rem col/row,
-  // hard/soft col/row bounds) from the node full to this node.
-  //----------------------------
-  // Note: if we store full set of logic/agorithm col/row, then
-  //       no diff are needed for col/row
-  //--------------------------------------------------------
+  // A child of the node installed last, i.e., a plunge, inherits all rows
+  // of its parent. If its basis is the one the parent left in the solver,
+  // the solver is resolved from its current state, factorization included.
+  bool keep_basis = parent_ && model->isLastInstalled(parent_) &&
+    desc->getWarmStart()==
+    dynamic_cast<DcoNodeDesc*>(parent_->getDesc())->getWarmStart();
+
+  //  1. Travel back to the installed path or to an explicit node
   //--------------------------------------------------------
-  // Collect differencing bounds. Branching bounds of this node
-  // are ALSO collected.
+  // Collect nodes whose differencing is not in the solver yet. This node is
+  // always collected, since it might be processed before and its
+  // description might have changed since then.
   //--------------------------------------------------------
-  /* First push this node since it has branching hard bounds.
-     NOTE: during rampup, this desc has full description when branch(). */
-
-  // column and row lower bounds
-  // todo(aykut) why do we need to write them to model->colLB_ fields?
-  // is it enough to have a local array?
-  // this creates a bug unless you restore the bounds to original values.
-  // this should be fixed.
-  double * colLB = model->colLB();
-  double * colUB = model->colUB();
-  CoinFillN(colLB, numCoreCols, -ALPS_DBL_MAX);
-  CoinFillN(colUB, numCoreCols, ALPS_DBL_MAX);
-  // generate path to root from this
+  // A relative node without a parent can not be installed, its bounds
+  // depend on ancestors that are not available.
+  if (!explicit_ && parent_==NULL) {
+    model->dcoMessageHandler_->message(DISCO_NODE_NOT_EXPLICIT,
+                                       *(model->dcoMessages_))
+      << broker()->getProcRank()
+      << getIndex()
+      << CoinMessageEol;
+    throw CoinError("Relative node without parent.", "installSubProblem",
+                    "DcoTreeNode");
+  }
   std::vector<AlpsTreeNode*> leafToRootPath;
   leafToRootPath.push_back(this);
-  if (broker_->getPhase() != AlpsPhaseRampup) {
+  AlpsTreeNode * common = NULL;
+  if (!explicit_) {
     AlpsTreeNode * parent = parent_;
     while(parent) {
+      if (model->isInstalled(parent)) {
+        // Reach the installed path, then stop.
+        common = parent;
+        break;
+      }
       leafToRootPath.push_back(parent);
       if (parent->getExplicit()) {
         // Reach an explicit node, then stop.
@@ -1018,163 +1206,63 @@ int DcoTreeNode::installSubProblem() {
       }
     }
   }
-  //------------------------------------------------------
-  // Travel back from this node to the explicit node to
-  // collect full description.
-  //------------------------------------------------------
-  int numOldRows = 0;
-  std::vector<DcoConstraint*> old_cons;
-  for(int i = static_cast<int> (leafToRootPath.size() - 1); i > -1; --i) {
-    //--------------------------------------------------
-    // NOTE: As away from explicit node, bounds become
-    //       tighter and tighter.
-    //--------------------------------------------------
-    // node description of node i
-    DcoNodeDesc * currDesc =
-      dynamic_cast<DcoNodeDesc*>((leafToRootPath.at(i))->getDesc());
-    //--------------------------------------------------
-    // Adjust bounds according to hard var lb/ub.
-    // If rampup or explicit, collect hard bounds so far.
-    //--------------------------------------------------
-    int index;
-    double value;
-    int numModify;
-    numModify = currDesc->getVars()->lbHard.numModify;
-    for (int k=0; k<numModify; ++k) {
-      index = currDesc->getVars()->lbHard.posModify[k];
-      value = currDesc->getVars()->lbHard.entries[k];
-      // Hard bounds do NOT change according to soft bounds, so
-      // here need CoinMax.
-      colLB[index] = CoinMax(colLB[index], value);
-    }
-    numModify = currDesc->getVars()->ubHard.numModify;
-    for (int k=0; k<numModify; ++k) {
-      int index = currDesc->getVars()->ubHard.posModify[k];
-      double value = currDesc->getVars()->ubHard.entries[k];
-      colUB[index] = CoinMin(colUB[index], value);
-    }
-    //--------------------------------------------------
-    // Adjust bounds according to soft var lb/ub.
-    // If rampup or explicit, collect soft bounds so far.
-    //--------------------------------------------------
-    numModify = currDesc->getVars()->lbSoft.numModify;
-    for (int k=0; k<numModify; ++k) {
-      index = currDesc->getVars()->lbSoft.posModify[k];
-      value = currDesc->getVars()->lbSoft.entries[k];
-      colLB[index] = CoinMax(colLB[index], value);
-    }
-    numModify = currDesc->getVars()->ubSoft.numModify;
-    for (int k=0; k<numModify; ++k) {
-      index = currDesc->getVars()->ubSoft.posModify[k];
-      value = currDesc->getVars()->ubSoft.entries[k];
-      colUB[index] = CoinMin(colUB[index], value);
-    }
-    //--------------------------------------------------
-    // TODO: Modify hard/soft row lb/ub.
-    //--------------------------------------------------
-    //--------------------------------------------------
-    // Collect active non-core constraints at parent.
-    //--------------------------------------------------
-    //----------------------------------------------
-    // First collect all generated cuts, then remove
-    // deleted.
-    //----------------------------------------------
-    int tempInt = currDesc->getCons()->numAdd;
-    for (int k=0; k<tempInt; ++k) {
-      DcoConstraint * aCon = dynamic_cast<DcoConstraint *>
-        (currDesc->getCons()->objects[k]);
-      old_cons.push_back(aCon);
-    }
-    //----------------------------------------------
-    // Remove those deleted.
-    // NOTE: old_cons stores all previously
-    // generated active constraints at parent.
-    //----------------------------------------------
-    tempInt = currDesc->getCons()->numRemove;
-    if (tempInt > 0) {
-      int tempPos;
-      int * tempMark = new int [numOldRows];
-      CoinZeroN(tempMark, numOldRows);
-      for (int k=0; k<tempInt; ++k) {
-        tempPos = currDesc->getCons()->posRemove[k];
-        tempMark[tempPos] = 1;
-      }
-      tempInt = 0;
-      for (int k=0; k<numOldRows; ++k) {
-        if (tempMark[k] != 1) {
-          // Survived.
-          old_cons[tempInt++] = old_cons[k];
-        }
-      }
-      if (tempInt + currDesc->getCons()->numRemove != numOldRows) {
-        std::cout << "INSTALL: tempInt=" << tempInt
-                  <<", numRemove="<<currDesc->getCons()->numRemove
-                  << ", numOldRows=" << numOldRows << std::endl;
-        assert(0);
-      }
-      // Update number of old non-core constraints.
-      numOldRows = tempInt;
-      delete [] tempMark;
-    }
-  } // EOF leafToRootPath.
-  //--------------------------------------------------------
-  // Clear path vector.
-  //--------------------------------------------------------
-  leafToRootPath.clear();
-  assert(leafToRootPath.size() == 0);
+  // End of 1
+
+  //  2. Undo changes below the common ancestor
+  if (common) {
+    model->undoInstalled(common->getDepth());
+  }
+  else {
+    model->clearInstalled();
+  }
   // End of 2
 
-  //  3. Set col bounds
-  //--------------------------------------------------------
-  // Adjust column bounds in lp solver
-  //--------------------------------------------------------
-  model->solver()->setColLower(colLB);
-  model->solver()->setColUpper(colUB);
+  //  3. Apply changes from the common ancestor to this node.
+  //--------------------------------------------------
+  // NOTE: As away from explicit node, bounds become
+  //       tighter and tighter.
+  //--------------------------------------------------
+  int pathSize = static_cast<int>(leafToRootPath.size());
+  for (int i=pathSize-1; i>-1; --i) {
+    bool base = (common==NULL) && (i==pathSize-1);
+    model->applyInstalled(leafToRootPath[i], base);
+  }
+  leafToRootPath.clear();
   // End of 3
 
-
-  //  4. Set row bounds (is this necessary?)
-
-  //  5. Add contraints except cores
-  //--------------------------------------------------------
-  // TODO: Set row bounds
-  //--------------------------------------------------------
-  //--------------------------------------------------------
-  // Add old constraints, which are collect from differencing.
-  //--------------------------------------------------------
-  // If removed cuts due to local cuts.
-  if (numOldRows > 0) {
-    const OsiRowCut ** oldOsiCuts = new const OsiRowCut * [numOldRows];
-    for (int k=0; k<numOldRows; ++k) {
-      OsiRowCut * acut = old_cons[k]->createOsiRowCut(model);
-      oldOsiCuts[k] = acut;
-    }
-    model->solver()->applyRowCuts(numOldRows, oldOsiCuts);
-    for (int k=0; k<numOldRows; ++k) {
-      delete oldOsiCuts[k];
-    }
-    delete [] oldOsiCuts;
-    oldOsiCuts = NULL;
+  //  4. Push changes to solver
+  model->syncInstalled();
+  // End of 4
+
+  // Store a full description if this node is far from its closest explicit
+  // ancestor, so that install and convertToExplicit() of its descendants
+  // walk a bounded path.
+  model->addInstallPath(pathSize, desc->getDiffDepth());
+  int snapshotDepth = model->dcoPar()->entry(DcoParams::snapshotDepth);
+  int snapshotBytes = model->dcoPar()->entry(DcoParams::snapshotBytes);
+  if (!explicit_ && broker_->getPhase() != AlpsPhaseRampup &&
+      ((snapshotDepth>0 && desc->getDiffDepth()>=snapshotDepth) ||
+       (snapshotBytes>0 && desc->getDiffBytes()>snapshotBytes))) {
+    snapshotDesc();
   }
-  old_cons.clear();
-  //  End of 5
+  // Convert explicit nodes back to relative if they take too much memory.
+  // Only the nodes registered by convertToExplicit() are converted,
+  // snapshots stay explicit to keep install paths bounded.
+  model->compactNodes(this);
 
-
-  //  6. Add variables except cores
-
-  //  7. Set basis (should not need modify)
-  //--------------------------------------------------------
-  // Add parent variables, which are collect from differencing.
-  //--------------------------------------------------------
+  //  5. Set basis (should not need modify)
   //--------------------------------------------------------
   // Set basis
   //--------------------------------------------------------
-  CoinWarmStartBasis *pws = desc->getBasis();
+  CoinWarmStartBasis *pws = keep_basis ? NULL : desc->createBasis();
   if (pws != NULL) {
+    // rows of the pool might have changed since the basis was stored.
+    model->adjustBasis(pws);
     model->solver()->setWarmStart(pws);
+    delete pws;
   }
   return status;
-  //  End of 7
+  //  End of 5
 }
 
 /** This method must be invoked on a \c pregnant node (which has all the
@@ -1198,6 +1286,7 @@ DcoTreeNode::branch() {
 
   // create return value and push the down and up nodes.
   std::vector< CoinTriple<AlpsNodeDesc*, AlpsNodeStatus, double> > res;
+  model->nodeTimer().start(DcoNodePhaseBranch);
 
 
   // check if this can be fathomed
@@ -1217,14 +1306,12 @@ DcoTreeNode::branch() {
       << CoinMessageEol;
 #endif
     setStatus(AlpsNodeStatusFathomed);
+    model->nodeTimer().stop();
     return res;
   }
   //todo(aykut) update scores
   //BcpsBranchStrategy * branchStrategy = model->branchStrategy();
 
-  // get Alps phase
-  AlpsPhase phase = broker()->getPhase();
-
   // get branch object
   DcoBranchObject const * branch_object =
     dynamic_cast<DcoBranchObject const *>(branchObject());
@@ -1245,65 +1332,67 @@ DcoTreeNode::branch() {
     << CoinMessageEol;
 #endif
 
-  // compute child nodes' warm start basis
-  // ownership is transferred to node description object, no need to free.
-  CoinWarmStartBasis * child_ws;
-  child_ws = (getDesc()->getBasis()==0) ? 0 :
-    new CoinWarmStartBasis(*getDesc()->getBasis());
+  // child nodes share the warm start basis of this node.
+  DcoWarmStart * child_ws = getDesc()->getWarmStart();
+#if defined(__OA__) || defined(__COLA__)
+  int chain_length = model->dcoPar()->entry(DcoParams::basisChainLength);
+#endif
 
   // create new node descriptions
   DcoNodeDesc * down_node = new DcoNodeDesc(model);
   down_node->setBroker(broker_);
   DcoNodeDesc * up_node = new DcoNodeDesc(model);
   up_node->setBroker(broker_);
-  if (phase == AlpsPhaseRampup) {
-    // Store a full description in the child nodes
-
-    // Down Node
-    // == copy description of this node to the down node
-    copyFullNode(down_node);
-    // == update the branching variable hard bounds for the down node
-    // todo(aykut) do we need lower bound for the down node?
-    // down_node->vars_->lbHard.entries[branch_var] =
-    //   model->getColLower()[branch_var];
-    down_node->vars()->ubHard.entries[branch_var] =
-      branch_object->ubDownBranch();
-
-    // Up Node
-    // == copy description of this node to up node
-    copyFullNode(up_node);
-    // == update the branching variable hard bounds for the up node
-    // todo(aykut) do we need upper bound for the up node?
-    up_node->vars()->lbHard.entries[branch_var] =
-      branch_object->lbUpBranch();
-    // up_node->vars_->ubHard.entries[branch_var] =
-    //   model->getColUpper()[branch_var];
-  }
-  else {
-    // Store node description relative to the parent.
-    // We need to add a hard bound for the branching variable.
-
-    double ub_down_branch = branch_object->ubDownBranch();
-    double lb_up_branch = branch_object->lbUpBranch();
-    // todo(aykut) where does colLB and colUB get updated?
-    // I think they should stay as they created.
-    //double lb = model->colLB()[branch_var];
-    //double ub = model->colUB()[branch_var];
-    double lb = model->getVariables()[branch_var]->getLbHard();
-    double ub = model->getVariables()[branch_var]->getUbHard();
-    down_node->setVarHardBound(1,
-                             &branch_var,
-                             &lb,
-                             1,
-                             &branch_var,
-                             &ub_down_branch);
-    up_node->setVarHardBound(1,
-                             &branch_var,
-                             &lb_up_branch,
-                             1,
-                             &branch_var,
-                             &ub);
+  // Store node description relative to the parent, also in ramp-up.
+  // An explicit copy is sent for relative nodes, see encode().
+  // We need to add a hard bound for the branching variable.
+  double ub_down_branch = branch_object->ubDownBranch();
+  double lb_up_branch = branch_object->lbUpBranch();
+  // todo(aykut) where does colLB and colUB get updated?
+  // I think they should stay as they created.
+  //double lb = model->colLB()[branch_var];
+  //double ub = model->colUB()[branch_var];
+  double lb = model->getVariables()[branch_var]->getLbHard();
+  double ub = model->getVariables()[branch_var]->getUbHard();
+  // bounds tightened by strong branching hold in both children.
+  std::vector<int> mod_index(1, branch_var);
+  std::vector<double> down_lb(1, lb);
+  std::vector<double> down_ub(1, ub_down_branch);
+  std::vector<double> up_lb(1, lb_up_branch);
+  std::vector<double> up_ub(1, ub);
+  std::vector<int> const & fix_index = branch_object->fixIndex();
+  for (std::size_t k=0; k<fix_index.size(); ++k) {
+    if (fix_index[k]==branch_var) {
+      continue;
+    }
+    mod_index.push_back(fix_index[k]);
+    down_lb.push_back(branch_object->fixLb()[k]);
+    down_ub.push_back(branch_object->fixUb()[k]);
+    up_lb.push_back(branch_object->fixLb()[k]);
+    up_ub.push_back(branch_object->fixUb()[k]);
   }
+  int num_mod = static_cast<int>(mod_index.size());
+  down_node->setVarHardBound(num_mod,
+                             &mod_index[0],
+                             &down_lb[0],
+                             num_mod,
+                             &mod_index[0],
+                             &down_ub[0]);
+  up_node->setVarHardBound(num_mod,
+                           &mod_index[0],
+                           &up_lb[0],
+                           num_mod,
+                           &mod_index[0],
+                           &up_ub[0]);
+
+  // == set distance of children to the closest explicit ancestor.
+  DcoNodeDesc * desc = dynamic_cast<DcoNodeDesc*>(getDesc());
+  int diff_depth = explicit_ ? 1 : desc->getDiffDepth()+1;
+  int diff_bytes = explicit_ ? 0 : desc->getDiffBytes();
+  down_node->setDiffDepth(diff_depth);
+  down_node->setDiffBytes(diff_bytes + down_node->boundBytes());
+  up_node->setDiffDepth(diff_depth);
+  up_node->setDiffBytes(diff_bytes + up_node->boundBytes());
 
   // Down Node
   // == set other relevant fields of down node
@@ -1312,7 +1401,13 @@ DcoTreeNode::branch() {
   down_node->setBranchedVal(branch_value);
   // == set warm start basis for the down node.
 #if defined(__OA__) || defined(__COLA__)
-  down_node->setBasis(child_ws);
+  down_node->shareBasis(child_ws);
+  // basis found by strong branching is stored relative to the shared one.
+  if (branch_object->downBasis()) {
+    CoinWarmStartBasis * ws =
+      new CoinWarmStartBasis(*branch_object->downBasis());
+    down_node->setBasis(ws, chain_length);
+  }
 #endif
   // Up Node
   // == set other relevant fields of up node
@@ -1321,18 +1416,26 @@ DcoTreeNode::branch() {
   up_node->setBranchedVal(branch_value);
   // == set warm start basis for the up node.
 #if defined(__OA__) || defined(__COLA__)
-  up_node->setBasis(child_ws);
+  up_node->shareBasis(child_ws);
+  if (branch_object->upBasis()) {
+    CoinWarmStartBasis * ws =
+      new CoinWarmStartBasis(*branch_object->upBasis());
+    up_node->setBasis(ws, chain_length);
+  }
 #endif
   // Alps does this. We do not need to change the status here
   //status_ = AlpsNodeStatusBranched;
 
   // push the down and up nodes.
+  // quality of children found by strong branching is a better bound.
   res.push_back(CoinMakeTriple(static_cast<AlpsNodeDesc*>(down_node),
                                AlpsNodeStatusCandidate,
-                               quality_));
+                               CoinMax(quality_,
+                                       branch_object->downQuality())));
   res.push_back(CoinMakeTriple(static_cast<AlpsNodeDesc*>(up_node),
                                AlpsNodeStatusCandidate,
-                               quality_));
+                               CoinMax(quality_,
+                                       branch_object->upQuality())));
 #ifdef DISCO_DEBUG
   // grumpy message
   int num_inf = 0;
@@ -1378,93 +1481,10 @@ DcoTreeNode::branch() {
   // todo(aykut) are these should be in alps level?
   //up_node->setSolEstimate(quality_);
   //down_node->setSolEstimate(quality_);
+  model->nodeTimer().stop();
   return res;
 }
 
-// Copies node description of this node to given child node.
-// New node is explicitly stored in the memory (no differencing).
-void DcoTreeNode::copyFullNode(DcoNodeDesc * child_node) const {
-  // get model the node belongs
-  DcoModel * model = dynamic_cast<DcoModel*>(broker_->getModel());
-  // get message handler and messages for loging
-  //CoinMessageHandler * message_handler = model->dcoMessageHandler_;
-  //CoinMessages * messages = model->dcoMessages_;
-  // get description of this node
-  DcoNodeDesc * node_desc = getDesc();
-
-  // solver number of columns
-  int num_cols = model->solver()->getNumCols();
-
-  // this will keep bound information, lower and upper
-  // it is used for both hard and soft bounds.
-  // ownership is transferred, no need to free
-  Bound bound;
-  bound.lower.ind = new int[num_cols];
-  bound.lower.val = new double[num_cols];
-  bound.upper.ind = new int[num_cols];
-  bound.upper.val = new double[num_cols];
-
-  // Hard bounds
-  // == Hard lower bounds
-  std::copy(node_desc->getVars()->lbHard.posModify,
-            node_desc->getVars()->lbHard.posModify + num_cols,
-            bound.lower.ind);
-  std::copy(node_desc->getVars()->lbHard.entries,
-            node_desc->getVars()->lbHard.entries + num_cols,
-            bound.lower.val);
-  // == Hard upper bounds
-  std::copy(node_desc->getVars()->ubHard.posModify,
-            node_desc->getVars()->ubHard.posModify + num_cols,
-            bound.upper.ind);
-  std::copy(node_desc->getVars()->ubHard.entries,
-            node_desc->getVars()->ubHard.entries + num_cols,
-            bound.upper.val);
-
-  // assign hard bounds for the child node.
-  // this takes ownership of the arrays.
-  child_node->assignVarHardBound(num_cols,
-                                 bound.lower.ind,
-                                 bound.lower.val,
-                                 num_cols,
-                                 bound.upper.ind,
-                                 bound.upper.val);
-
-  // Soft bounds.
-  // == Soft lower bounds
-  // number of entries modified for soft lower bounds
-  int sl_num_modify = node_desc->getVars()->lbSoft.numModify;
-  // We can reuse bound here since previos arrays are owned by Bcps.
-  bound.lower.ind = new int[sl_num_modify];
-  bound.lower.val = new double[sl_num_modify];
-  std::copy(node_desc->getVars()->lbSoft.posModify,
-            node_desc->getVars()->lbSoft.posModify + sl_num_modify,
-            bound.lower.ind);
-  std::copy(node_desc->getVars()->lbSoft.entries,
-            node_desc->getVars()->lbSoft.entries + sl_num_modify,
-            bound.lower.val);
-
-  // == Soft upper bounds
-  // number of entries modified for soft upper bounds
-  int su_num_modify = node_desc->getVars()->ubSoft.numModify;
-  bound.upper.ind = new int[su_num_modify];
-  bound.upper.val = new double[su_num_modify];
-  std::copy(node_desc->getVars()->ubSoft.posModify,
-            node_desc->getVars()->ubSoft.posModify + su_num_modify,
-            bound.upper.ind);
-  std::copy(node_desc->getVars()->ubSoft.entries,
-            node_desc->getVars()->ubSoft.entries + su_num_modify,
-            bound.upper.val);
-
-  // Assign soft bounds for the child node.
-  child_node->assignVarSoftBound(sl_num_modify,
-                                 bound.lower.ind,
-                                 bound.lower.val,
-                                 su_num_modify,
-                                 bound.upper.ind,
-                                 bound.upper.val);
-}
-
-
 DcoNodeDesc * DcoTreeNode::getDesc() const {
   return dynamic_cast<DcoNodeDesc*>(AlpsTreeNode::getDesc());
 }
@@ -1476,8 +1496,9 @@ void DcoTreeNode::processSetPregnant() {
   DcoModel * model = dynamic_cast<DcoModel*>(broker()->getModel());
   CoinWarmStartBasis * ws = NULL;
   ws = dynamic_cast<CoinWarmStartBasis*>(model->solver()->getWarmStart());
-  // store basis in the node desciption.
-  getDesc()->setBasis(ws);
+  // store basis in the node desciption, relative to the basis of the parent.
+  int chain_length = model->dcoPar()->entry(DcoParams::basisChainLength);
+  getDesc()->setBasis(ws, chain_length);
   // set status pregnant
   setStatus(AlpsNodeStatusPregnant);
 
@@ -1591,8 +1612,10 @@ void DcoTreeNode::branchConstrainOrPrice(BcpsSubproblemStatus subproblem_status,
   int numRowsInf;
   double colInf;
   double rowInf;
+  model->nodeTimer().start(DcoNodePhaseFeasibility);
   DcoSolution * sol = model->feasibleSolution(numColsInf, colInf,
                                               numRowsInf, rowInf);
+  model->nodeTimer().stop();
   // Summary of following if else chain
   // if (both relaxed cols and rows are infeasible) {
   //   decide what to do
@@ -1801,14 +1824,20 @@ void DcoTreeNode::applyConstraints(BcpsConstraintPool const * conPool) {
   double density_par = model->dcoPar()->entry(DcoParams::denseConFactor);
   //double tailoff = model->dcoPar()->entry(DcoParams::tailOff);
   double cone_tol = model->dcoPar()->entry(DcoParams::coneTol);
+  double dup_tol = model->dcoPar()->entry(DcoParams::cutDuplicateTol);
+  double par_tol = model->dcoPar()->entry(DcoParams::cutParallelTol);
   double const * sol = model->solver()->getColSolution();
   int num_cols = model->solver()->getNumCols();
 
   // Tranform constraints to Osi cut.
   int num_cuts = conPool->getNumConstraints();
   OsiRowCut const ** cuts_to_add = new OsiRowCut const * [num_cuts];
+  DcoLinearConstraint ** cons_to_add = new DcoLinearConstraint * [num_cuts];
   int num_add = 0;
   std::vector<int> cuts_to_del;
+  // cuts that pass the filters and their violations
+  std::vector<int> cands;
+  std::vector<double> cand_viol;
 
   // iterate over cuts and
   //------------------------------------------
@@ -1818,6 +1847,7 @@ void DcoTreeNode::applyConstraints(BcpsConstraintPool const * conPool) {
   //  (3) bad scaled cuts
   //  (4) weak cuts
   //  (5) almost parallel cuts
+  // Then select the best of the remaining cuts and OA cuts.
   //------------------------------------------
   for (int i=0; i<num_cuts; ++i) {
     DcoLinearConstraint * curr_con =
@@ -1828,11 +1858,18 @@ void DcoTreeNode::applyConstraints(BcpsConstraintPool const * conPool) {
     double curr_con_lb = curr_con->getLbSoft();
     double curr_con_ub = curr_con->getUbSoft();
 
-    // add all OA cuts
+    // OA cuts skip the filters, they compete in cut selection only.
     if (curr_con->constraintType() == DcoConstraintTypeOA) {
-      cuts_to_add[num_add++] = curr_con->createOsiRowCut(model);
-      // update cut statistics
-      model->conGenerators(curr_con->constraintType())->stats().addNumConsUsed(1);
+      double activity = 0.0;
+      for (int k=0; k<length; ++k) {
+        activity += elements[k] * sol[indices[k]];
+      }
+      double rowLower = CoinMax(curr_con->getLbHard(),
+                                curr_con->getLbSoft());
+      double rowUpper = CoinMin(curr_con->getUbHard(),
+                                curr_con->getUbSoft());
+      cands.push_back(i);
+      cand_viol.push_back(CoinMax(rowLower-activity, activity-rowUpper));
       continue;
     }
 
@@ -1912,132 +1949,52 @@ void DcoTreeNode::applyConstraints(BcpsConstraintPool const * conPool) {
       continue;
     }
 
-    // (5) Check almost parallel cuts
-    // create dense cut
-    double * dense_cut = new double[num_cols]();
-    double cut_norm = 0.0;
-    for (int i = 0; i < length; ++i) {
-      dense_cut[indices[i]] = elements[i];
-      cut_norm += elements[i]*elements[i];
-    }
-    cut_norm = sqrt(cut_norm);
-
-    // {
-    //   // check which one cuts the solution for problem r22c30k10i20
-    //   double sol[] = {7.0, 2.0, 6.25, 8.0, 7.0, 3.85714285091261, 6.0,
-    //                   3.0, 3.85714279912700, 8.0, 3.0, 7.4, 12, 5,
-    //                   10.75, 8, 4, 6, 12, 3, 9, 9,
-    //                   6, 5, 10, 4, 8.2, 7, 6, 2.4, 0.0};
-    //   // check whether cut_i cuts the sol
-    //   double activity = std::inner_product(sol, sol+30, dense_cut, 0.0);
-    //   std::cout << curr_con_lb << " " << activity << " " << curr_con_ub << std::endl;
-    //   if (activity < curr_con_lb or activity > curr_con_ub) {
-    //     std::cout << "=================================================="
-    //               << std::endl;
-    //     std::cout << "size: " <<  curr_con->getSize() << std::endl;
-    //     std::cout << "ind" << std::endl;
-    //     for (int ii=0; ii<curr_con->getSize(); ++ii) {
-    //       std::cout << curr_con->getIndices()[ii] << " ";
-    //     }
-    //     std::cout << std::endl;
-    //     std::cout << "val" << std::endl;
-    //     for (int ii=0; ii<curr_con->getSize(); ++ii) {
-    //       std::cout << curr_con->getValues()[ii] << " ";
-    //     }
-    //     std::cout << std::endl;
-    //     std::cout << "lb " << curr_con_lb << std::endl;
-    //     std::cout << "ub " << curr_con_ub << std::endl;
-
-    //     std::cout << "=================================================="
-    //               << std::endl;
-    //     //throw std::exception();
-    //   }
-    // }
-
+    // (5) Check duplicate and almost parallel cuts. Only the solver rows
+    // with the same sparsity pattern are compared, see
+    // DcoModel::parallelRow().
     bool added = false;
-    // Check whether cut is parallel to an existing constraint or cut.
-    {
-      // cut is stored at dense_cut
-      // compute par := max _i { cut^T a_i / |cut| |a_i| } where a_i is
-      // constraint. cut is discarded if par > 0.98
-      //double par_factor = 0.0;
-      // iterate over constraints
-      CoinPackedMatrix const * mat = model->solver()->getMatrixByRow();
+    double cosine;
+    double scale;
+    int row = model->parallelRow(length, indices, elements, cosine, scale);
+    if (row!=-1 and cosine > dup_tol) {
+      // cut coeff are same, update bound if tighter
       double const * lb = model->solver()->getRowLower();
       double const * ub = model->solver()->getRowUpper();
-      int num_rows = mat->getNumRows();
-      // iterate over rows
-      for (int k = 0; k < num_rows; ++k) {
-        // get row
-        //int row_size = mat->getVectorStarts()[k+1] - mat->getVectorStarts()[k];
-        int row_size = mat->getVectorLast(k) - mat->getVectorFirst(k);
-        int const * ind = mat->getIndices() + mat->getVectorFirst(k);
-        double const * val = mat->getElements() + mat->getVectorFirst(k);
-        double inn_prod = 0.0;
-        double row_norm = 0.0;
-
-        if (length != row_size) {
-          // cut and rows are of different size
-          // check next row
-          continue;
-        }
-
-        for (int j = 0; j < row_size; ++j) {
-          inn_prod += val[j]*dense_cut[ind[j]];
-          row_norm += val[j]*val[j];
-        }
-        row_norm = sqrt(row_norm);
-        // divide by norms
-        inn_prod = inn_prod/(cut_norm*row_norm);
-        // todo(aykut) parametrize the following.
-        if (inn_prod > 0.99999) {
-          // cut coeff are same, update bound if tighter
-
-          // scale cut lower and upper bounds
-          double scale = 0.0;
-          scale = val[0]/dense_cut[ind[0]];
-          if (curr_con_lb > -1e8 and lb[k] < scale * curr_con_lb) {
-            if (index_ == 0) {
-              added = true;
-              model->solver()->setRowLower(k, scale*curr_con_lb-0.000001);
-              break;
-            }
-            else {
-              // keep the cut
-              inn_prod = 0.0;
-            }
-          }
-          if (curr_con_ub < 1e8 and ub[k] > scale * curr_con_ub) {
-            // we can do this only at root, else just keep it as a cut
-            if (index_ == 0) {
-              added = true;
-              model->solver()->setRowUpper(k, scale*curr_con_ub+0.000001);
-              break;
-            }
-            else {
-              // keep the cut
-              inn_prod = 0.0;
-            }
-          }
-        }
-        if (inn_prod > 0.95 and !cuts_to_del.empty() and i != cuts_to_del.back()) {
-          // almost parallel
-          cuts_to_del.push_back(i);
+      bool tighter_lb = curr_con_lb > -1e8 and lb[row] < scale*curr_con_lb;
+      bool tighter_ub = curr_con_ub < 1e8 and ub[row] > scale*curr_con_ub;
+      if (!tighter_lb and !tighter_ub) {
+        // duplicate, discard it.
+        cuts_to_del.push_back(i);
+        continue;
+      }
+      // we can do this only at root, else just keep it as a cut
+      if (index_ == 0) {
+        added = true;
+        if (tighter_lb) {
+          model->solver()->setRowLower(row, scale*curr_con_lb-0.000001);
         }
-        if (!cuts_to_del.empty() and i == cuts_to_del.back()) {
-          // already decided to delete the cut, no need to check other
-          // constraints/cuts currently in the solver
-          break;
+        if (tighter_ub) {
+          model->solver()->setRowUpper(row, scale*curr_con_ub+0.000001);
         }
       }
     }
-    // update cut statistics
-    model->conGenerators(curr_con->constraintType())->stats().addNumConsUsed(1);
-    if (not added) {
-      cuts_to_add[num_add++] = curr_con->createOsiRowCut(model);
+    else if (row!=-1 and cosine > par_tol) {
+      // almost parallel, discard it.
+      cuts_to_del.push_back(i);
+      continue;
+    }
+    if (added) {
+      // update cut statistics
+      model->conGenerators(curr_con->constraintType())->stats().
+        addNumConsUsed(1);
+    }
+    else {
+      cands.push_back(i);
+      cand_viol.push_back(violation);
     }
-    delete[] dense_cut;
   }
+  // (6) keep the best cuts within the budget of the round
+  num_add = selectCuts(conPool, cands, cand_viol, cuts_to_add, cons_to_add);
 
   // Add cuts to lp and adjust basis.
   CoinWarmStartBasis * ws = dynamic_cast<CoinWarmStartBasis*>
@@ -2071,6 +2028,18 @@ void DcoTreeNode::applyConstraints(BcpsConstraintPool const * conPool) {
     for (int k=0; k<num_add; ++k) {
       delete cuts_to_add[k];
     }
+    // Record cuts in the description, descendants inherit them and they
+    // stay in the solver row pool. Constraints of the pool are freed after
+    // this round, store copies.
+    std::vector<BcpsObject*> objects(num_add);
+    std::vector<DcoConstraint*> node_cons(num_add);
+    for (int k=0; k<num_add; ++k) {
+      DcoLinearConstraint * con = new DcoLinearConstraint(*cons_to_add[k]);
+      objects[k] = con;
+      node_cons[k] = con;
+    }
+    getDesc()->appendCons(num_add, &objects[0]);
+    model->addInstalledCons(num_add, &node_cons[0]);
   }
 
 #ifdef DISCO_DEBUG
@@ -2085,9 +2054,110 @@ void DcoTreeNode::applyConstraints(BcpsConstraintPool const * conPool) {
 #endif
 
   delete[] cuts_to_add;
+  delete[] cons_to_add;
   if (ws) delete ws;
 }
 
+int DcoTreeNode::selectCuts(BcpsConstraintPool const * conPool,
+                            std::vector<int> const & cands,
+                            std::vector<double> const & violation,
+                            OsiRowCut const ** cutsToAdd,
+                            DcoLinearConstraint ** selected) {
+  DcoModel * model = dynamic_cast<DcoModel*>(broker()->getModel());
+  double cut_factor = model->dcoPar()->entry(DcoParams::cutFactor);
+  double obj_weight = model->dcoPar()->entry(DcoParams::cutObjParallelWeight);
+  double min_orth = model->dcoPar()->entry(DcoParams::cutMinOrthogonality);
+  int num_cands = static_cast<int>(cands.size());
+  int num_core = model->getNumCoreLinearConstraints() +
+    model->getNumCoreConicConstraints();
+  int budget = num_cands;
+  if (cut_factor > 1.0) {
+    budget = CoinMax(1, static_cast<int>((cut_factor-1.0)*num_core));
+  }
+  //--------------------------------------------------------
+  // Score candidates, efficacy relative to the best one plus weighted
+  // objective parallelism.
+  //--------------------------------------------------------
+  int num_cols = model->solver()->getNumCols();
+  double const * obj = model->solver()->getObjCoefficients();
+  double obj_norm = sqrt(std::inner_product(obj, obj+num_cols, obj, 0.0));
+  std::vector<DcoLinearConstraint*> cons(num_cands);
+  std::vector<double> norm(num_cands);
+  std::vector<double> efficacy(num_cands);
+  std::vector<double> score(num_cands);
+  double max_efficacy = 0.0;
+  for (int c=0; c<num_cands; ++c) {
+    cons[c] = dynamic_cast<DcoLinearConstraint*>
+      (conPool->getConstraint(cands[c]));
+    int length = cons[c]->getSize();
+    double const * val = cons[c]->getValues();
+    int const * ind = cons[c]->getIndices();
+    double obj_prod = 0.0;
+    for (int k=0; k<length; ++k) {
+      obj_prod += val[k]*obj[ind[k]];
+    }
+    norm[c] = sqrt(std::inner_product(val, val+length, val, 0.0));
+    efficacy[c] = norm[c]>0.0 ? violation[c]/norm[c] : 0.0;
+    max_efficacy = CoinMax(max_efficacy, efficacy[c]);
+    score[c] = (obj_norm>0.0 and norm[c]>0.0) ?
+      obj_weight*fabs(obj_prod)/(obj_norm*norm[c]) : 0.0;
+  }
+  if (max_efficacy>0.0) {
+    for (int c=0; c<num_cands; ++c) {
+      score[c] += efficacy[c]/max_efficacy;
+    }
+  }
+  //--------------------------------------------------------
+  // Greedy selection, candidates almost parallel to a selected cut are
+  // dropped.
+  //--------------------------------------------------------
+  std::vector<char> alive(num_cands, 1);
+  std::vector<double> dense(num_cols, 0.0);
+  int num_selected = 0;
+  while (num_selected<budget) {
+    int best = -1;
+    for (int c=0; c<num_cands; ++c) {
+      if (alive[c] and (best==-1 or score[c]>score[best])) {
+        best = c;
+      }
+    }
+    if (best==-1) {
+      break;
+    }
+    alive[best] = 0;
+    selected[num_selected] = cons[best];
+    cutsToAdd[num_selected++] = cons[best]->createOsiRowCut(model);
+    // update cut statistics
+    model->conGenerators(cons[best]->constraintType())->stats().
+      addNumConsUsed(1);
+    if (norm[best]==0.0 or min_orth<=0.0) {
+      continue;
+    }
+    int length = cons[best]->getSize();
+    double const * val = cons[best]->getValues();
+    int const * ind = cons[best]->getIndices();
+    for (int k=0; k<length; ++k) {
+      dense[ind[k]] = val[k];
+    }
+    for (int c=0; c<num_cands; ++c) {
+      if (!alive[c] or norm[c]==0.0) {
+        continue;
+      }
+      double inn_prod = 0.0;
+      for (int k=0; k<cons[c]->getSize(); ++k) {
+        inn_prod += cons[c]->getValues()[k]*dense[cons[c]->getIndices()[k]];
+      }
+      if (1.0 - fabs(inn_prod)/(norm[best]*norm[c]) < min_orth) {
+        alive[c] = 0;
+      }
+    }
+    for (int k=0; k<length; ++k) {
+      dense[ind[k]] = 0.0;
+    }
+  }
+  return num_selected;
+}
+
 /// Pack this into an encoded object.
 AlpsReturnStatus DcoTreeNode::encode(AlpsEncoded * encoded) const {
   // get pointers for message logging
@@ -2095,6 +2165,16 @@ AlpsReturnStatus DcoTreeNode::encode(AlpsEncoded * encoded) const {
 
   // return value
   AlpsReturnStatus status;
+  // The receiving process does not have the ancestors of this node, it
+  // should be sent with a full description. Ramp-up children are relative,
+  // an explicit copy is sent for them.
+  if (!explicit_) {
+    DcoTreeNode * copy = createExplicitCopy();
+    status = copy->encode(encoded);
+    delete copy;
+    return status;
+  }
+
   status = AlpsTreeNode::encode(encoded);
   assert(status==AlpsReturnStatusOk);
   status = BcpsTreeNode::encode(encoded);
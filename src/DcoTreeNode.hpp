@@ -28,6 +28,9 @@
 #include <BcpsTreeNode.h>
 #include "DcoNodeDesc.hpp"
 #include "DcoModel.hpp"
+#include "DcoSlabAllocator.hpp"
+
+class DcoLinearConstraint;
 
 /*!
   This class represents a node of the branch and bound tree. This class is a
@@ -172,7 +175,9 @@
         <li> installSubProblem()<br>
 
         Installs the subproblem being represented by the node to the solver
-        interface.
+        interface. The model remembers the subproblem installed last, only
+        the changes from the common ancestor of the two nodes are pushed to
+        the solver.
 
         <li> bound()<br>
 
@@ -238,25 +243,25 @@ class DcoTreeNode: public BcpsTreeNode {
     double startObjVal_;
     // number of bunding iteraton for milp cuts
     int numMilpIter_;
-    // how many times the cut in the current solver was inactive?
+    // how many times in a row the cut in the current solver was inactive?
     // indices of cuts are model->numLinearRows(), ... ,
     // model->solver()->getNumRows()-1. inactive_[i] is the number of times cut
     // i is inactive. cut i is the current i+model->numLinearRows() th row of
     // solver.
-    std::list<int> inactive_;
+    std::vector<int> inactive_;
     // generator of cuts. generatorIndex_[i] returns the index of the cut generator
     // in model()->conGenerators_, i.e.,
     // model()->conGenerators()[generatorIndex_[i]] is the generator of the cut
     // sitting at index i.
-    std::list<int> generatorIndex_;
+    std::vector<int> generatorIndex_;
+    // solver rows of the cuts to delete before the next resolve, in
+    // increasing order.
+    std::vector<int> purge_;
   };
   BcpStats bcpStats_;
   /// Decide whether the given cut generator should be used, based on the cut
   /// strategy.
   void decide_using_cg(bool & do_use, DcoConGenerator * cg, int type) const;
-  /// Copies node description of this node to given child node.
-  /// New node is explicitly stored in the memory (no differencing).
-  void copyFullNode(DcoNodeDesc * child_node) const;
   /// Sets node status to pregnant and carries necessary operations.
   void processSetPregnant();
   /// This function is called after bound method is called. It checks solver
@@ -265,8 +270,47 @@ class DcoTreeNode: public BcpsTreeNode {
   int boundingLoop(bool isRoot, bool rampUp);
   /// find number of infeasible integer variables.
   void checkRelaxedCols(int & numInf);
-  /// update cut stats and clean in necessary
+  /// Select the best cuts among candidates by efficacy, objective
+  /// parallelism and orthogonality to the cuts already selected, at most
+  /// (cutFactor-1) * number of core rows. Candidates are positions in
+  /// conPool, violation of each candidate is given. Selected cuts are
+  /// written to cutsToAdd and their constraints to selected, returns their
+  /// number.
+  int selectCuts(BcpsConstraintPool const * conPool,
+                 std::vector<int> const & cands,
+                 std::vector<double> const & violation,
+                 OsiRowCut const ** cutsToAdd,
+                 DcoLinearConstraint ** selected);
+  /// update cut stats and mark cuts inactive for too long for deletion
   void checkCuts();
+  /// delete the cuts marked by checkCuts() from the solver, called right
+  /// before the solver is resolved. Deleted cuts are removed from the
+  /// description of this node.
+  void purgeCuts();
+  /// Replace bound differencing of this node with a full description built
+  /// from the installed subproblem. Should be called after the node is
+  /// installed.
+  void snapshotDesc();
+  /// Compute non-core constraints of this node by walking up to its closest
+  /// explicit ancestor, in the order DcoModel::applyInstalled() installs
+  /// them.
+  void collectCons(std::vector<DcoConstraint*> & cons) const;
+  /// Compute column bounds of this node by walking up to its closest
+  /// explicit ancestor. Returns the number of non-core constraints of the
+  /// node.
+  int collectBounds(double * lb, double * ub) const;
+  /// Replace bounds of the description of this node with the bounds that
+  /// are tighter than the base bounds. Soft bounds are merged into hard
+  /// bounds.
+  void assignBounds(double const * lb, double const * ub,
+                    double const * baseLB, double const * baseUB);
+  /// Add depth and bytes to the differencing distance of the relative
+  /// descendants whose closest explicit ancestor was this node.
+  void shiftDescendantDiff(int depth, int bytes);
+  /// Create an explicit node with the same bounds, constraints, basis and
+  /// search data as this one. This node is not changed. Caller owns the
+  /// returned node.
+  DcoTreeNode * createExplicitCopy() const;
  public:
   ///@name Constructors and Destructors
   //@{
@@ -278,6 +322,16 @@ class DcoTreeNode: public BcpsTreeNode {
   virtual ~DcoTreeNode();
   //@}
 
+  ///@name Memory management
+  //@{
+  /// Allocate from the tree node slab allocator.
+  static void * operator new(std::size_t size);
+  /// Give memory back to the tree node slab allocator.
+  static void operator delete(void * ptr, std::size_t size);
+  /// Slab allocator of tree nodes, for statistics.
+  static DcoSlabAllocator const & allocator();
+  //@}
+
   ///@name Virtual functions inherited from AlpsTreeNode
   //@{
   /// Create new tree nodes from the given description.
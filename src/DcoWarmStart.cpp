@@ -0,0 +1,198 @@
+/*===========================================================================*
+ * This file is part of the Discrete Conic Optimization (DisCO) Solver.      *
+ *                                                                           *
+ * DisCO is distributed under the Eclipse Public License as part of the      *
+ * COIN-OR repository (http://www.coin-or.org).                              *
+ *                                                                           *
+ * Authors:                                                                  *
+ *          Aykut Bulut, Lehigh University                                   *
+ *          Yan Xu, Lehigh University                                        *
+ *          Ted Ralphs, Lehigh University                                    *
+ *                                                                           *
+ * Copyright (C) 2001-2018, Lehigh University, Aykut Bulut, Yan Xu, and      *
+ *                          Ted Ralphs.                                      *
+ * All Rights Reserved.                                                      *
+ *===========================================================================*/
+
+
+#include "DcoWarmStart.hpp"
+
+#include <CoinHelperFunctions.hpp>
+
+#include <cstring>
+
+int DcoWarmStart::numStored_ = 0;
+int DcoWarmStart::numShared_ = 0;
+long long int DcoWarmStart::storedBytes_ = 0;
+long long int DcoWarmStart::fullBytes_ = 0;
+long long int DcoWarmStart::liveBytes_ = 0;
+long long int DcoWarmStart::peakBytes_ = 0;
+
+// marks words of artificial statuses in diffIndex_
+static unsigned int const artificialMask = 0x80000000u;
+
+// one instance per node that stores a basis.
+static DcoSlabAllocator warmStartAllocator("Warm start",
+                                           sizeof(DcoWarmStart), 1024);
+
+void * DcoWarmStart::operator new(std::size_t size) {
+  return warmStartAllocator.allocate(size);
+}
+
+void DcoWarmStart::operator delete(void * ptr, std::size_t size) {
+  warmStartAllocator.deallocate(ptr, size);
+}
+
+DcoSlabAllocator const & DcoWarmStart::allocator() {
+  return warmStartAllocator;
+}
+
+DcoWarmStart::DcoWarmStart(CoinWarmStartBasis const * basis,
+                           DcoWarmStart * parent, int maxChainLength) {
+  refCount_ = 1;
+  parent_ = NULL;
+  chainLength_ = 0;
+  full_ = NULL;
+  numStructural_ = basis->getNumStructural();
+  numArtificial_ = basis->getNumArtificial();
+  numDiff_ = 0;
+  diffIndex_ = NULL;
+  diffWord_ = NULL;
+  // diffs are generated against a resized parent basis, it can grow but not
+  // shrink.
+  if (parent==NULL || parent->chainLength_>=maxChainLength ||
+      numStructural_<parent->numStructural_ ||
+      numArtificial_<parent->numArtificial_) {
+    storeFull(basis);
+  }
+  else {
+    CoinWarmStartBasis * parent_basis = parent->createBasis();
+    parent_basis->resize(numArtificial_, numStructural_);
+    int num_struct_words = (numStructural_+15)>>4;
+    int num_artif_words = (numArtificial_+15)>>4;
+    int max_diff = num_struct_words + num_artif_words;
+    unsigned int * index = new unsigned int[max_diff];
+    unsigned int * word = new unsigned int[max_diff];
+    int num_diff = 0;
+    unsigned int new_word;
+    unsigned int old_word;
+    char const * new_status = basis->getStructuralStatus();
+    char const * old_status = parent_basis->getStructuralStatus();
+    for (int i=0; i<num_struct_words; ++i) {
+      std::memcpy(&new_word, new_status+4*i, 4);
+      std::memcpy(&old_word, old_status+4*i, 4);
+      if (new_word!=old_word) {
+        index[num_diff] = i;
+        word[num_diff++] = new_word;
+      }
+    }
+    new_status = basis->getArtificialStatus();
+    old_status = parent_basis->getArtificialStatus();
+    for (int i=0; i<num_artif_words; ++i) {
+      std::memcpy(&new_word, new_status+4*i, 4);
+      std::memcpy(&old_word, old_status+4*i, 4);
+      if (new_word!=old_word) {
+        index[num_diff] = i | artificialMask;
+        word[num_diff++] = new_word;
+      }
+    }
+    delete parent_basis;
+    if (2*num_diff*static_cast<int>(sizeof(unsigned int)) >=
+        fullSize(numStructural_, numArtificial_)) {
+      // diff does not save memory.
+      storeFull(basis);
+    }
+    else {
+      numDiff_ = num_diff;
+      diffIndex_ = new unsigned int[num_diff];
+      diffWord_ = new unsigned int[num_diff];
+      CoinDisjointCopyN(index, num_diff, diffIndex_);
+      CoinDisjointCopyN(word, num_diff, diffWord_);
+      parent_ = parent;
+      parent_->addRef();
+      chainLength_ = parent->chainLength_ + 1;
+    }
+    delete[] index;
+    delete[] word;
+  }
+  // update statistics
+  int size = bytes();
+  numStored_++;
+  storedBytes_ += size;
+  liveBytes_ += size;
+  peakBytes_ = CoinMax(peakBytes_, liveBytes_);
+}
+
+DcoWarmStart::~DcoWarmStart() {
+  liveBytes_ -= bytes();
+  if (full_) {
+    delete full_;
+  }
+  if (diffIndex_) {
+    delete[] diffIndex_;
+  }
+  if (diffWord_) {
+    delete[] diffWord_;
+  }
+  release(parent_);
+}
+
+void DcoWarmStart::storeFull(CoinWarmStartBasis const * basis) {
+  full_ = new CoinWarmStartBasis(*basis);
+}
+
+int DcoWarmStart::fullSize(int numStructural, int numArtificial) {
+  return static_cast<int>(sizeof(CoinWarmStartBasis)) +
+    4*(((numStructural+15)>>4) + ((numArtificial+15)>>4));
+}
+
+void DcoWarmStart::addRef() {
+  refCount_++;
+}
+
+void DcoWarmStart::release(DcoWarmStart *& ws) {
+  if (ws) {
+    ws->refCount_--;
+    if (ws->refCount_==0) {
+      delete ws;
+    }
+    ws = NULL;
+  }
+}
+
+CoinWarmStartBasis * DcoWarmStart::createBasis() const {
+  if (full_) {
+    return new CoinWarmStartBasis(*full_);
+  }
+  CoinWarmStartBasis * basis = parent_->createBasis();
+  basis->resize(numArtificial_, numStructural_);
+  char * structural = basis->getStructuralStatus();
+  char * artificial = basis->getArtificialStatus();
+  for (int k=0; k<numDiff_; ++k) {
+    unsigned int index = diffIndex_[k];
+    if (index & artificialMask) {
+      index &= ~artificialMask;
+      std::memcpy(artificial+4*index, diffWord_+k, 4);
+    }
+    else {
+      std::memcpy(structural+4*index, diffWord_+k, 4);
+    }
+  }
+  return basis;
+}
+
+int DcoWarmStart::bytes() const {
+  int size = static_cast<int>(sizeof(DcoWarmStart));
+  if (full_) {
+    size += fullSize(numStructural_, numArtificial_);
+  }
+  else {
+    size += 2*numDiff_*static_cast<int>(sizeof(unsigned int));
+  }
+  return size;
+}
+
+void DcoWarmStart::addShare(DcoWarmStart const * ws) {
+  numShared_++;
+  fullBytes_ += fullSize(ws->numStructural_, ws->numArtificial_);
+}
@@ -0,0 +1,126 @@
+/*===========================================================================*
+ * This file is part of the Discrete Conic Optimization (DisCO) Solver.      *
+ *                                                                           *
+ * DisCO is distributed under the Eclipse Public License as part of the      *
+ * COIN-OR repository (http://www.coin-or.org).                              *
+ *                                                                           *
+ * Authors:                                                                  *
+ *          Aykut Bulut, Lehigh University                                   *
+ *          Yan Xu, Lehigh University                                        *
+ *          Ted Ralphs, Lehigh University                                    *
+ *                                                                           *
+ * Copyright (C) 2001-2018, Lehigh University, Aykut Bulut, Yan Xu, and      *
+ *                          Ted Ralphs.                                      *
+ * All Rights Reserved.                                                      *
+ *===========================================================================*/
+
+
+#ifndef DcoWarmStart_hpp_
+#define DcoWarmStart_hpp_
+
+#include <CoinWarmStartBasis.hpp>
+#include "DcoSlabAllocator.hpp"
+
+/*!
+  Stores a warm start basis of a node in compact form.
+
+  Statuses are kept as in CoinWarmStartBasis, packed 2 bits per status in
+  32 bit words. A basis is stored either in full or as the words that differ
+  from the basis it is created relative to (parent), usually the basis of the
+  parent node. Diff chains are limited in length, a basis is stored in full
+  when the chain gets long or the diff is not smaller than the full basis.
+
+  Instances are reference counted, so children of a node share the basis of
+  their parent instead of copying it. Use addRef() to share and release()
+  instead of delete.
+
+  Storage statistics of all instances are kept in static members, since the
+  instances are not owned by the model. Like DcoSlabAllocator, they are not
+  thread safe, instances must not be created or released inside OpenMP
+  regions.
+*/
+
+class DcoWarmStart {
+  /// Number of references to this.
+  int refCount_;
+  /// Basis this is stored relative to, NULL if stored in full.
+  DcoWarmStart * parent_;
+  /// Number of diffs to the closest basis stored in full.
+  int chainLength_;
+  /// Basis, NULL if stored as a diff.
+  CoinWarmStartBasis * full_;
+  /// Number of structural statuses.
+  int numStructural_;
+  /// Number of artificial statuses.
+  int numArtificial_;
+  /// Number of words that differ from the parent basis.
+  int numDiff_;
+  /// Indices of the words that differ, artificial words are marked with the
+  /// highest bit.
+  unsigned int * diffIndex_;
+  /// Values of the words that differ.
+  unsigned int * diffWord_;
+
+  ///@name Storage statistics
+  //@{
+  /// Number of bases stored.
+  static int numStored_;
+  /// Number of node references to stored bases.
+  static int numShared_;
+  /// Bytes used by bases stored so far.
+  static long long int storedBytes_;
+  /// Bytes the stored bases would take as full copies for each node.
+  static long long int fullBytes_;
+  /// Bytes used by the bases in memory.
+  static long long int liveBytes_;
+  /// Maximum of #liveBytes_.
+  static long long int peakBytes_;
+  //@}
+
+  DcoWarmStart();
+  DcoWarmStart(DcoWarmStart const & other);
+  DcoWarmStart & operator=(DcoWarmStart const & rhs);
+  /// Destructor is private, use release().
+  ~DcoWarmStart();
+  /// Store basis in full.
+  void storeFull(CoinWarmStartBasis const * basis);
+  /// Bytes used by basis with given number of statuses, when stored in full.
+  static int fullSize(int numStructural, int numArtificial);
+public:
+  /// Create from the given basis. Basis is stored relative to parent if
+  /// parent is not NULL and the chain of parent is shorter than
+  /// maxChainLength. Does not take ownership of basis.
+  DcoWarmStart(CoinWarmStartBasis const * basis, DcoWarmStart * parent,
+               int maxChainLength);
+  /// Add a reference.
+  void addRef();
+  /// Remove a reference, free ws if there is none left. Sets ws to NULL.
+  static void release(DcoWarmStart *& ws);
+  /// Create the basis. Caller owns the returned object.
+  CoinWarmStartBasis * createBasis() const;
+  /// Bytes used by this instance.
+  int bytes() const;
+
+  ///@name Get storage statistics
+  //@{
+  /// Record that a node refers to ws.
+  static void addShare(DcoWarmStart const * ws);
+  static int numStored() { return numStored_; }
+  static int numShared() { return numShared_; }
+  static long long int storedBytes() { return storedBytes_; }
+  static long long int fullBytes() { return fullBytes_; }
+  static long long int peakBytes() { return peakBytes_; }
+  //@}
+
+  ///@name Memory management
+  //@{
+  /// Allocate from the warm start slab allocator.
+  static void * operator new(std::size_t size);
+  /// Give memory back to the warm start slab allocator.
+  static void operator delete(void * ptr, std::size_t size);
+  /// Slab allocator of warm starts, for statistics.
+  static DcoSlabAllocator const & allocator();
+  //@}
+};
+
+#endif